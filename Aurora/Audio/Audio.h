@@ -19,6 +19,7 @@ namespace Aurora
 
         bool Initialize() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_Transforms | SubsystemResource_Rendering, SubsystemResource_Audio, false }; } // Our listener follows the renderer's camera.
 
         FMOD::System* GetAudioContext() const { return m_AudioContext; }
 
@@ -4,6 +4,7 @@
 #include "../Window/WindowContext.h"
 #include "Settings.h"
 #include "../Threading/Threading.h"
+#include "../Threading/IOService.h"
 #include "../Time/Timer.h"
 #include "../Input/Input.h"
 #include "../Renderer/Renderer.h"
@@ -21,7 +22,7 @@ namespace Aurora
         AURORA_ERROR(LogLayer::Engine, "Systems Initialized!");
     }
 
-    Engine::Engine()
+    Engine::Engine(const ThreadingConfiguration& threadingConfiguration)
     {
         AURORA_PROFILE_FUNCTION();
 
@@ -36,6 +37,7 @@ namespace Aurora
 
         // Register Subsystem
         m_EngineContext->RegisterSubsystem<Timer>();
+        m_EngineContext->RegisterSubsystem<IOService>(); // Ahead of Threading, so its IO threads are shut down before the workers their completions run on.
         m_EngineContext->RegisterSubsystem<Threading>();
         m_EngineContext->RegisterSubsystem<Settings>();
         m_EngineContext->RegisterSubsystem<Audio>();
@@ -47,6 +49,9 @@ namespace Aurora
         m_EngineContext->RegisterSubsystem<ResourceCache>();
         m_EngineContext->RegisterSubsystem<Scripting>();
 
+        // Read by Threading and the IO Service as they spawn their threads, which happens before Settings itself initializes.
+        m_EngineContext->GetSubsystem<Settings>()->SetThreadingConfiguration(threadingConfiguration);
+
         // Initialize Subsystem
         m_EngineContext->Initialize();
 
@@ -2,6 +2,7 @@
 #include <unordered_map>
 #include <memory>
 #include "Core.h"
+#include "SettingsUtilities.h"
 
 namespace Aurora
 {
@@ -18,7 +19,7 @@ namespace Aurora
     class Engine
     {
     public:
-        Engine();
+        Engine(const ThreadingConfiguration& threadingConfiguration = ThreadingConfiguration()); // Handed to Settings ahead of any subsystem initializing, as threads are spawned during initialization.
         ~Engine();
 
         void Tick() const; // Supplies deltaTime from the Time subsystem.
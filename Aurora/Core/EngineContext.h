@@ -3,6 +3,7 @@
 #include <memory>
 #include "../Log/Log.h"
 #include "ISubsystem.h"
+#include "SubsystemTickGraph.h"
 #include "Engine.h"
 #include "../Events/EventSystem.h"
 
@@ -41,6 +42,7 @@ namespace Aurora
         void RegisterSubsystem()
         {
             m_Subsystems.emplace_back(std::make_shared<T>(this));
+            m_TickGraph.Invalidate();
         }
 
         template<typename T>
@@ -83,14 +85,14 @@ namespace Aurora
             {
                 m_Subsystems.erase(m_Subsystems.begin() + subsystemIndex);
             }
+
+            m_TickGraph.Invalidate();
         }
 
+        // Ticks every subsystem, running those that don't conflict with one another in parallel. See SubsystemTickGraph.h.
         void Tick(float deltaTime)
         {
-            for (const _Subsystem& subsystem : m_Subsystems)
-            {
-                subsystem.m_Pointer->Tick(deltaTime);
-            }
+            m_TickGraph.Tick(this, deltaTime);
         }
 
         void Shutdown()
@@ -105,9 +107,11 @@ namespace Aurora
         std::vector<_Subsystem>::iterator end() { return m_Subsystems.end(); }
 
         Engine* GetEngine() { return m_Engine; }
+        SubsystemTickGraph& GetTickGraph() { return m_TickGraph; }
 
     private:
         std::vector<_Subsystem> m_Subsystems;
+        SubsystemTickGraph m_TickGraph;
         Engine* m_Engine = nullptr;
     };
 }
\ No newline at end of file
@@ -1,10 +1,36 @@
 #pragma once
+#include <cstdint>
 
 namespace Aurora
 {
     class EngineContext;
     class InputEvent;
 
+    // Engine wide state touched by subsystem ticks. Used by the tick graph (see SubsystemTickGraph.h) to decide which ticks may run alongside one another.
+    enum SubsystemResource : uint32_t
+    {
+        SubsystemResource_None       = 0,
+        SubsystemResource_Time       = 1 << 0,
+        SubsystemResource_Window     = 1 << 1,  // Windows and OS event polling.
+        SubsystemResource_Input      = 1 << 2,  // Polled keyboard and mouse state.
+        SubsystemResource_Audio      = 1 << 3,
+        SubsystemResource_Physics    = 1 << 4,  // The physics world and its bodies.
+        SubsystemResource_Transforms = 1 << 5,
+        SubsystemResource_Entities   = 1 << 6,  // Entities and their components, transforms aside.
+        SubsystemResource_Rendering  = 1 << 7,  // Renderer state, including debug primitives.
+        SubsystemResource_Resources  = 1 << 8,
+        SubsystemResource_Scripts    = 1 << 9,
+        SubsystemResource_Profiling  = 1 << 10, // Profiler entries and trace output.
+        SubsystemResource_All        = ~0u
+    };
+
+    struct SubsystemTickAccess
+    {
+        uint32_t m_Reads = SubsystemResource_All;
+        uint32_t m_Writes = SubsystemResource_All;
+        bool m_RequiresMainThread = true; // Ticks that touch thread affine APIs (GLFW, the immediate graphics context) must stay on the main thread.
+    };
+
     class ISubsystem : public std::enable_shared_from_this<ISubsystem>
     {
     public:
@@ -16,7 +42,10 @@ namespace Aurora
         virtual void Shutdown() {}
         virtual void OnEvent(InputEvent& inputEvent) {}
 
+        // What our Tick reads and writes. Subsystems that don't override this are assumed to touch everything on the main thread, and are thus ticked in isolation.
+        virtual SubsystemTickAccess GetTickAccess() const { return SubsystemTickAccess(); }
+
     protected:
         EngineContext* m_EngineContext;
     };
-}
\ No newline at end of file
+}
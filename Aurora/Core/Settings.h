@@ -14,6 +14,7 @@ namespace Aurora
 
         // Subsystem
         bool Initialize() override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_None, false }; } // We don't tick.
 
         // Name
         void SetApplicationName(const std::string& applicationName) { m_ApplicationName = applicationName; }
@@ -35,11 +36,16 @@ namespace Aurora
         std::string& GetProjectDirectory() { return m_ProjectDirectory; }
         std::string GetProjectDirectoryAbsolute() const;
 
+        // Threading - Set by the Engine from its constructor, and read once by the Threading and IO Service subsystems upon initialization. Changes made after have no effect.
+        void SetThreadingConfiguration(const ThreadingConfiguration& threadingConfiguration) { m_ThreadingConfiguration = threadingConfiguration; }
+        const ThreadingConfiguration& GetThreadingConfiguration() const { return m_ThreadingConfiguration; }
+
     private:
         std::string m_ApplicationName = "Default Application";
 
         std::string m_ProjectDirectory;
         std::unordered_map<ResourceDirectory, std::string> m_ResourceDirectories;
         std::vector<ExternalLibrary> m_ExternalLibraries;
+        ThreadingConfiguration m_ThreadingConfiguration;
     };
 }
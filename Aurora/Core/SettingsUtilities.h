@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <cstdint>
 
 namespace Aurora
 {
@@ -60,4 +61,13 @@ namespace Aurora
         std::string m_Version;
         std::string m_URL;
     };
+
+    // Worker counts for each class of thread in our job system. See Threading.h.
+    struct ThreadingConfiguration
+    {
+        uint32_t m_FrameWorkerCount = 0;      // Workers for frame critical jobs. 0 uses every hardware thread not taken by the main thread or background workers.
+        uint32_t m_BackgroundWorkerCount = 1; // Workers reserved for long running jobs such as file I/O and asset imports.
+        bool m_PinWorkersToCores = true;      // Pins each frame worker to its own physical core.
+        uint32_t m_IOWorkerCount = 2;         // Threads of the IOService, which only ever block on file reads. See IOService.h.
+    };
 }
\ No newline at end of file
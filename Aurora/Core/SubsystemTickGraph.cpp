@@ -0,0 +1,149 @@
+#include "Aurora.h"
+#include "SubsystemTickGraph.h"
+#include <typeinfo>
+#include <chrono>
+
+namespace Aurora
+{
+    bool SubsystemTickGraph::IsConflicting(const SubsystemTickAccess& earlierAccess, const SubsystemTickAccess& laterAccess)
+    {
+        // Read after write, write after read and write after write hazards. Two readers never conflict.
+        return (earlierAccess.m_Writes & (laterAccess.m_Reads | laterAccess.m_Writes)) != 0 || (earlierAccess.m_Reads & laterAccess.m_Writes) != 0;
+    }
+
+    void SubsystemTickGraph::Build(EngineContext* engineContext)
+    {
+        m_Nodes.clear();
+        m_Threading = engineContext->GetSubsystem<Threading>();
+
+        for (const _Subsystem& subsystem : *engineContext)
+        {
+            Node node;
+            node.m_Subsystem = subsystem.m_Pointer.get();
+            node.m_Access = node.m_Subsystem->GetTickAccess();
+
+            // Strip "class Aurora::" and the likes for readability.
+            node.m_Name = typeid(*node.m_Subsystem).name();
+            const size_t nameStart = node.m_Name.find_last_of(": ");
+            if (nameStart != std::string::npos)
+            {
+                node.m_Name = node.m_Name.substr(nameStart + 1);
+            }
+
+            m_Nodes.emplace_back(std::move(node));
+        }
+
+        // Ancestors of each node, so we can drop dependencies that are already implied by another one.
+        const uint32_t nodeCount = static_cast<uint32_t>(m_Nodes.size());
+        std::vector<std::vector<bool>> ancestors(nodeCount, std::vector<bool>(nodeCount, false));
+
+        for (uint32_t nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++)
+        {
+            Node& node = m_Nodes[nodeIndex];
+
+            // Walk backwards, so nearer dependencies are kept and anything they already wait on is skipped.
+            for (uint32_t earlierIndex = nodeIndex; earlierIndex-- > 0;)
+            {
+                if (!IsConflicting(m_Nodes[earlierIndex].m_Access, node.m_Access) || ancestors[nodeIndex][earlierIndex])
+                {
+                    continue;
+                }
+
+                node.m_Dependencies.push_back(earlierIndex);
+                ancestors[nodeIndex][earlierIndex] = true;
+                for (uint32_t ancestorIndex = 0; ancestorIndex < earlierIndex; ancestorIndex++)
+                {
+                    if (ancestors[earlierIndex][ancestorIndex])
+                    {
+                        ancestors[nodeIndex][ancestorIndex] = true;
+                    }
+                }
+            }
+        }
+
+        m_JobHandles.assign(nodeCount, JobHandle());
+        m_IsDirty = false;
+    }
+
+    void SubsystemTickGraph::TickNode(uint32_t nodeIndex, float deltaTime)
+    {
+        Node& node = m_Nodes[nodeIndex];
+
+        const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+        node.m_Subsystem->Tick(deltaTime);
+        node.m_TickMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    void SubsystemTickGraph::Tick(EngineContext* engineContext, float deltaTime)
+    {
+        if (m_IsDirty)
+        {
+            Build(engineContext);
+        }
+
+        const std::chrono::high_resolution_clock::time_point frameStartTime = std::chrono::high_resolution_clock::now();
+        const bool isParallel = m_IsParallelTickEnabled && m_Threading != nullptr;
+
+        for (uint32_t nodeIndex = 0; nodeIndex < static_cast<uint32_t>(m_Nodes.size()); nodeIndex++)
+        {
+            Node& node = m_Nodes[nodeIndex];
+
+            if (!isParallel || node.m_Access.m_RequiresMainThread)
+            {
+                if (isParallel)
+                {
+                    for (const uint32_t dependencyIndex : node.m_Dependencies)
+                    {
+                        m_Threading->Wait(m_JobHandles[dependencyIndex]);
+                    }
+                }
+
+                TickNode(nodeIndex, deltaTime);
+                m_JobHandles[nodeIndex] = JobHandle();
+            }
+            else
+            {
+                // Main thread ticks have already completed by the time we get here, hence their (invalid) handles are simply skipped.
+                m_DependencyHandles.clear();
+                for (const uint32_t dependencyIndex : node.m_Dependencies)
+                {
+                    m_DependencyHandles.push_back(m_JobHandles[dependencyIndex]);
+                }
+
+                AURORA_JOB_LABEL(node.m_Name.c_str());
+                m_JobHandles[nodeIndex] = m_Threading->Execute([this, nodeIndex, deltaTime](JobInformation jobInformation)
+                {
+                    TickNode(nodeIndex, deltaTime);
+                }, m_DependencyHandles.data(), static_cast<uint32_t>(m_DependencyHandles.size()));
+            }
+        }
+
+        // Everything after our tick (the editor, presentation) expects the frame's simulation to be complete.
+        if (isParallel)
+        {
+            for (const JobHandle& jobHandle : m_JobHandles)
+            {
+                m_Threading->Wait(jobHandle);
+            }
+        }
+
+        // Statistics
+        m_WallMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - frameStartTime).count();
+        m_SerialMilliseconds = 0.0;
+        m_CriticalPathMilliseconds = 0.0;
+
+        m_PathMilliseconds.assign(m_Nodes.size(), 0.0);
+        for (uint32_t nodeIndex = 0; nodeIndex < static_cast<uint32_t>(m_Nodes.size()); nodeIndex++)
+        {
+            double longestDependencyPath = 0.0;
+            for (const uint32_t dependencyIndex : m_Nodes[nodeIndex].m_Dependencies)
+            {
+                longestDependencyPath = std::max(longestDependencyPath, m_PathMilliseconds[dependencyIndex]);
+            }
+
+            m_PathMilliseconds[nodeIndex] = longestDependencyPath + m_Nodes[nodeIndex].m_TickMilliseconds;
+            m_SerialMilliseconds += m_Nodes[nodeIndex].m_TickMilliseconds;
+            m_CriticalPathMilliseconds = std::max(m_CriticalPathMilliseconds, m_PathMilliseconds[nodeIndex]);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "ISubsystem.h"
+#include "../Threading/Threading.h"
+
+/* == Subsystem Tick Graph ==
+
+    Rather than ticking every subsystem one after another on the main thread, we build a graph from the resources each subsystem declares it reads and writes (see
+    ISubsystem::GetTickAccess). A tick depends on every earlier registered tick it conflicts with - that is, whenever either of them writes something the other touches. Ticks
+    without such conflicts run concurrently on the job system, while registration order is preserved between those that do conflict.
+
+    Ticks that require the main thread run inline once their dependencies complete, with the main thread waiting (and helping out, if allowed to) in the meantime. The graph is
+    rebuilt whenever subsystems are registered or removed.
+
+    Each frame we time every tick, allowing us to compare the frame's wall time against the serial sum of all ticks and against the graph's critical path.
+*/
+
+namespace Aurora
+{
+    class EngineContext;
+
+    class SubsystemTickGraph
+    {
+    public:
+        struct Node
+        {
+            ISubsystem* m_Subsystem = nullptr;
+            std::string m_Name;
+            SubsystemTickAccess m_Access;
+            std::vector<uint32_t> m_Dependencies; // Indices of earlier nodes we must wait on, without those already implied by another dependency.
+            double m_TickMilliseconds = 0.0;      // Duration of our last tick.
+        };
+
+        void Invalidate() { m_IsDirty = true; }
+        void Tick(EngineContext* engineContext, float deltaTime);
+
+        void SetParallelTickEnabled(bool isEnabled) { m_IsParallelTickEnabled = isEnabled; }
+        bool IsParallelTickEnabled() const { return m_IsParallelTickEnabled; }
+
+        // Statistics of the last frame.
+        const std::vector<Node>& GetNodes() const { return m_Nodes; }
+        double GetWallMilliseconds() const { return m_WallMilliseconds; }
+        double GetSerialMilliseconds() const { return m_SerialMilliseconds; }             // Sum of all ticks - what a purely serial frame would have taken.
+        double GetCriticalPathMilliseconds() const { return m_CriticalPathMilliseconds; } // The longest chain of dependent ticks - the best a parallel frame could do.
+
+        static bool IsConflicting(const SubsystemTickAccess& earlierAccess, const SubsystemTickAccess& laterAccess);
+
+    private:
+        void Build(EngineContext* engineContext);
+        void TickNode(uint32_t nodeIndex, float deltaTime);
+
+    private:
+        std::vector<Node> m_Nodes;
+        std::vector<JobHandle> m_JobHandles;        // Per node, for the current frame.
+        std::vector<JobHandle> m_DependencyHandles; // Scratch space for gathering a node's dependencies.
+        std::vector<double> m_PathMilliseconds;     // Longest chain of ticks ending at each node.
+        Threading* m_Threading = nullptr;
+        bool m_IsDirty = true;
+        bool m_IsParallelTickEnabled = true;
+
+        double m_WallMilliseconds = 0.0;
+        double m_SerialMilliseconds = 0.0;
+        double m_CriticalPathMilliseconds = 0.0;
+    };
+}
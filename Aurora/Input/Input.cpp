@@ -30,6 +30,29 @@ namespace Aurora
         glfwPollEvents();
 
         PollMouse();  // To ensure that our mouse position and delta is always computed.
+        PollButtons();
+    }
+
+    void Input::PollButtons()
+    {
+        if (!m_QueryWindow)
+        {
+            return;
+        }
+
+        GLFWwindow* queryWindow = static_cast<GLFWwindow*>(m_QueryWindow);
+
+        // Key codes below the space key aren't valid to GLFW.
+        for (int keyCode = AURORA_KEY_SPACE; keyCode <= AURORA_KEY_LAST; keyCode++)
+        {
+            const int keyState = glfwGetKey(queryWindow, keyCode);
+            m_KeyStates[keyCode] = keyState == GLFW_PRESS || keyState == GLFW_REPEAT;
+        }
+
+        for (int mouseCode = 0; mouseCode <= AURORA_MOUSE_BUTTON_LAST; mouseCode++)
+        {
+            m_MouseButtonStates[mouseCode] = glfwGetMouseButton(queryWindow, mouseCode) == GLFW_PRESS;
+        }
     }
 
     void Input::PollMouse()
@@ -62,13 +85,11 @@ namespace Aurora
 
     bool Input::IsKeyPressed(int keyCode)
     {
-        int keyState = glfwGetKey(static_cast<GLFWwindow*>(m_QueryWindow), keyCode);
-        return keyState == GLFW_PRESS || keyState == GLFW_REPEAT;
+        return keyCode >= 0 && keyCode <= AURORA_KEY_LAST && m_KeyStates[keyCode];
     }
 
     bool Input::IsMouseButtonPressed(int mouseCode)
     {
-        int mouseState = glfwGetMouseButton(static_cast<GLFWwindow*>(m_QueryWindow), mouseCode);
-        return mouseState == GLFW_PRESS;
+        return mouseCode >= 0 && mouseCode <= AURORA_MOUSE_BUTTON_LAST && m_MouseButtonStates[mouseCode];
     }
 }
\ No newline at end of file
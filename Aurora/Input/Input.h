@@ -4,6 +4,7 @@
 #include "InputEvents/KeyEvent.h"
 #include "InputEvents/MouseEvent.h"
 #include "../Input/InputUtilities.h"
+#include <bitset>
 
 /* Personal Notes:
 
@@ -12,6 +13,9 @@
 
     The input system is currently polling based, meaning we check for inputs directly every frame. We could convert this into an event based input system, but at this 
     point there really is no need to do so. See: https://www.reddit.com/r/gamedev/comments/1qee41/using_event_driven_vs_polling_input/.
+
+    As GLFW may only be queried from the main thread, we snapshot the key and mouse button states once per tick. IsKeyPressed and IsMouseButtonPressed read from that
+    snapshot, allowing subsystems ticking on worker threads (such as the World) to query input safely.
 */
 
 namespace Aurora
@@ -24,8 +28,10 @@ namespace Aurora
 
         bool Initialize() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_Window, SubsystemResource_Window | SubsystemResource_Input, true }; } // GLFW must be polled from the main thread.
 
         void PollMouse();
+        void PollButtons();
 
         bool SetQueryWindow(void* window); // The window we're querying inputs for.
 
@@ -47,5 +53,8 @@ namespace Aurora
 
         std::pair<float, float> m_MousePositionPreviousFrame;
         std::pair<float, float> m_MousePositionDelta;
+
+        std::bitset<AURORA_KEY_LAST + 1> m_KeyStates;
+        std::bitset<AURORA_MOUSE_BUTTON_LAST + 1> m_MouseButtonStates;
     };
 }
\ No newline at end of file
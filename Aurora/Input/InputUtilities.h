@@ -144,4 +144,5 @@
 #define AURORA_KEY_RIGHT_CONTROL      345
 #define AURORA_KEY_RIGHT_ALT          346
 #define AURORA_KEY_RIGHT_SUPER        347
-#define AURORA_KEY_MENU               348
\ No newline at end of file
+#define AURORA_KEY_MENU               348
+#define AURORA_KEY_LAST               AURORA_KEY_MENU
\ No newline at end of file
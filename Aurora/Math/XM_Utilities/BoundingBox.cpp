@@ -52,7 +52,43 @@ namespace Aurora
 
     BoundingBox BoundingBox::Transform(const XMMATRIX& transform) const
     {
-        return BoundingBox();
+        if (!Defined())
+        {
+            return BoundingBox();
+        }
+
+        XMFLOAT4X4 matrix;
+        XMStoreFloat4x4(&matrix, transform);
+
+        // Transform the center, then take each axis' extent as the sum of the absolute contributions of our extents along that axis.
+        const Vector3 center = GetCenter();
+        const Vector3 extents = GetExtents();
+
+        const Vector3 centerTransformed(
+            center.x * matrix._11 + center.y * matrix._21 + center.z * matrix._31 + matrix._41,
+            center.x * matrix._12 + center.y * matrix._22 + center.z * matrix._32 + matrix._42,
+            center.x * matrix._13 + center.y * matrix._23 + center.z * matrix._33 + matrix._43
+        );
+
+        const Vector3 extentsTransformed(
+            Helper::Absolute(matrix._11) * extents.x + Helper::Absolute(matrix._21) * extents.y + Helper::Absolute(matrix._31) * extents.z,
+            Helper::Absolute(matrix._12) * extents.x + Helper::Absolute(matrix._22) * extents.y + Helper::Absolute(matrix._32) * extents.z,
+            Helper::Absolute(matrix._13) * extents.x + Helper::Absolute(matrix._23) * extents.y + Helper::Absolute(matrix._33) * extents.z
+        );
+
+        return BoundingBox(centerTransformed - extentsTransformed, centerTransformed + extentsTransformed);
+    }
+
+    void BoundingBox::Merge(const Vector3& point)
+    {
+        m_Minimum = Vector3(Helper::Minimum(m_Minimum.x, point.x), Helper::Minimum(m_Minimum.y, point.y), Helper::Minimum(m_Minimum.z, point.z));
+        m_Maximum = Vector3(Helper::Maximum(m_Maximum.x, point.x), Helper::Maximum(m_Maximum.y, point.y), Helper::Maximum(m_Maximum.z, point.z));
+    }
+
+    void BoundingBox::Merge(const BoundingBox& boundingBox)
+    {
+        m_Minimum = Vector3(Helper::Minimum(m_Minimum.x, boundingBox.m_Minimum.x), Helper::Minimum(m_Minimum.y, boundingBox.m_Minimum.y), Helper::Minimum(m_Minimum.z, boundingBox.m_Minimum.z));
+        m_Maximum = Vector3(Helper::Maximum(m_Maximum.x, boundingBox.m_Maximum.x), Helper::Maximum(m_Maximum.y, boundingBox.m_Maximum.y), Helper::Maximum(m_Maximum.z, boundingBox.m_Maximum.z));
     }
 
 
@@ -45,6 +45,20 @@ namespace Aurora
         // Returns a transformed bounding box.
         BoundingBox Transform(const XMMATRIX& transform) const;
 
+        // Grows to enclose the given point or bounding box.
+        void Merge(const Vector3& point);
+        void Merge(const BoundingBox& boundingBox);
+
+        // Returns a copy grown by the given margin along every axis, in both directions.
+        BoundingBox Expanded(float margin) const { return BoundingBox(m_Minimum - Vector3(margin), m_Maximum + Vector3(margin)); }
+
+        // Returns the area of all six faces. Cheaper bounding boxes to test against have smaller surface areas, hence its use as a cost by spatial structures.
+        float GetSurfaceArea() const
+        {
+            const Vector3 size = GetSize();
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
         // ====================================================================================
 
         const Vector3& GetMinimum() const { return m_Minimum; }
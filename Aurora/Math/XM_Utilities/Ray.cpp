@@ -26,32 +26,44 @@ namespace Aurora
             return 0.0f;
         }
 
-        float distance = Helper::Infinity;
+        // Slab test - intersect the ray with the pair of planes bounding each axis, keeping the latest entry and earliest exit.
+        float entryDistance = 0.0f;
+        float exitDistance = Helper::Infinity;
 
-        // Check for intersection in the X direction.
-        if (m_Start.x < boundingBox.GetMinimum().x && m_Direction.x > 0.0f) 
+        const float start[3] = { m_Start.x, m_Start.y, m_Start.z };
+        const float direction[3] = { m_Direction.x, m_Direction.y, m_Direction.z };
+        const float minimum[3] = { boundingBox.GetMinimum().x, boundingBox.GetMinimum().y, boundingBox.GetMinimum().z };
+        const float maximum[3] = { boundingBox.GetMaximum().x, boundingBox.GetMaximum().y, boundingBox.GetMaximum().z };
+
+        for (uint32_t axis = 0; axis < 3; axis++)
         {
-            const float x = (boundingBox.GetMinimum().x - m_Start.x) / m_Direction.x;
-            if (x < distance)
+            if (direction[axis] == 0.0f)
             {
-                const Vector3 point = m_Start + x * m_Direction;
-                if (point.y >= boundingBox.GetMinimum().y && point.y <= boundingBox.GetMaximum().y && point.z >= boundingBox.GetMinimum().z && point.z <= boundingBox.GetMaximum().z)
+                // Parallel to this slab, hence we never enter it unless already within.
+                if (start[axis] < minimum[axis] || start[axis] > maximum[axis])
                 {
-                    distance = x;
+                    return Helper::Infinity;
                 }
+
+                continue;
             }
-        }
 
-        if (m_Start.x > boundingBox.GetMaximum().x && m_Direction.x < 0.0f)
-        {
+            const float inverseDirection = 1.0f / direction[axis];
+            float nearDistance = (minimum[axis] - start[axis]) * inverseDirection;
+            float farDistance = (maximum[axis] - start[axis]) * inverseDirection;
+            if (nearDistance > farDistance)
+            {
+                std::swap(nearDistance, farDistance);
+            }
 
+            entryDistance = Helper::Maximum(entryDistance, nearDistance);
+            exitDistance = Helper::Minimum(exitDistance, farDistance);
+            if (entryDistance > exitDistance)
+            {
+                return Helper::Infinity;
+            }
         }
 
-        // Check for intersection in the Y direction.
-
-        // Check for intersection in the Z direction.
-
-
-        return distance;
+        return entryDistance;
     }
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace Aurora
 
         bool Initialize() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_Time, SubsystemResource_Physics | SubsystemResource_Transforms | SubsystemResource_Rendering | SubsystemResource_Profiling, false }; } // Motion states write transforms, debug drawing emits lines.
 
         // Enable or disable the physics simulation.
         void SetPhysicsSimulationEnabled(bool value) { m_IsSimulationEnabled = value; }
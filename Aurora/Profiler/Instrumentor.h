@@ -4,6 +4,10 @@
 #include <algorithm>
 #include <mutex>
 #include <chrono>
+#include <unordered_map>
+#include <iomanip>
+#include <atomic>
+#include <thread>
 
 namespace Aurora
 {
@@ -53,6 +57,7 @@ namespace Aurora
             }
 
             m_IsSessionActive = false;
+            WriteThreadNames();
             WriteFooter();
             m_OutputStream.close();
             m_ProfileCount = 0;
@@ -86,11 +91,81 @@ namespace Aurora
             m_OutputStream << "}";
         }
 
+        // Writes a complete event with sub-microsecond timestamps and optional arguments (a JSON object body, such as "\"group\":3"). Used for events recorded outside of
+        // InstrumentorTimer, such as job system traces.
+        void WriteEvent(const std::string& eventName, const char* category, double startMicroseconds, double durationMicroseconds, uint32_t threadID, const std::string& arguments = "")
+        {
+            std::lock_guard<std::mutex> lock(m_Lock);
+
+            if (!m_IsSessionActive)
+            {
+                return;
+            }
+
+            if (m_ProfileCount++ > 0)
+            {
+                m_OutputStream << ",";
+            }
+
+            std::string name = eventName;
+            std::replace(name.begin(), name.end(), '"', '\'');
+
+            const std::ios_base::fmtflags previousFlags = m_OutputStream.flags();
+            const std::streamsize previousPrecision = m_OutputStream.precision();
+            m_OutputStream << std::fixed << std::setprecision(3);
+
+            m_OutputStream << "{";
+            m_OutputStream << "\"cat\":\"" << category << "\",";
+            m_OutputStream << "\"dur\":" << durationMicroseconds << ',';
+            m_OutputStream << "\"name\":\"" << name << "\",";
+            m_OutputStream << "\"ph\":\"X\",";
+            m_OutputStream << "\"pid\":0,";
+            m_OutputStream << "\"tid\":" << threadID << ",";
+            m_OutputStream << "\"ts\":" << startMicroseconds;
+            if (!arguments.empty())
+            {
+                m_OutputStream << ",\"args\":{" << arguments << "}";
+            }
+            m_OutputStream << "}";
+
+            m_OutputStream.flags(previousFlags);
+            m_OutputStream.precision(previousPrecision);
+        }
+
+        // Names are written as metadata at the end of every session, so trace viewers label rows with them rather than raw thread IDs.
+        void SetThreadName(uint32_t threadID, const std::string& threadName)
+        {
+            std::lock_guard<std::mutex> lock(m_Lock);
+            m_ThreadNames[threadID] = threadName;
+        }
+
+        void WriteThreadNames()
+        {
+            std::lock_guard<std::mutex> lock(m_Lock);
+
+            for (const auto& threadName : m_ThreadNames)
+            {
+                if (m_ProfileCount++ > 0)
+                {
+                    m_OutputStream << ",";
+                }
+
+                m_OutputStream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << threadName.first << ",\"args\":{\"name\":\"" << threadName.second << "\"}}";
+            }
+        }
+
         void WriteFooter()
         {
             m_OutputStream << "]}";
         }
 
+        bool IsSessionActive() const { return m_IsSessionActive; }
+
+        static uint32_t GetThreadID(std::thread::id threadID = std::this_thread::get_id())
+        {
+            return static_cast<uint32_t>(std::hash<std::thread::id>{}(threadID));
+        }
+
     private:
         Instrumentor()
         {
@@ -102,7 +177,8 @@ namespace Aurora
         std::ofstream m_OutputStream;
         int m_ProfileCount = 0;
         std::mutex m_Lock;
-        bool m_IsSessionActive = false;
+        std::atomic<bool> m_IsSessionActive{ false };
+        std::unordered_map<uint32_t, std::string> m_ThreadNames;
     };
 
     class InstrumentorTimer
@@ -127,7 +203,7 @@ namespace Aurora
 
             m_Result.m_Start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
             m_Result.m_End = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
-            m_Result.m_ThreadID = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            m_Result.m_ThreadID = Instrumentor::GetThreadID();
             Instrumentor::GetInstance().WriteProfile(m_Result);
 
             m_HasStopped = true;
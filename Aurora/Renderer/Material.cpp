@@ -91,11 +91,12 @@ namespace Aurora
 
                         if (!texture)
                         {
-                            m_EngineContext->GetSubsystem<Threading>()->Execute([this, texture, materialPath, slot](JobInformation jobInformation) mutable
+                            AURORA_JOB_LABEL("Load Material Texture");
+                            m_EngineContext->GetSubsystem<Threading>()->Execute([this, materialPath, slot](JobInformation jobInformation)
                             {
-                                texture = m_EngineContext->GetSubsystem<ResourceCache>()->Load<DX11_Texture>(materialPath);
+                                const std::shared_ptr<DX11_Texture> texture = m_EngineContext->GetSubsystem<ResourceCache>()->Load<DX11_Texture>(materialPath);
                                 SetTextureSlot(slot, texture, GetProperty(slot));
-                            });
+                            }, {}, JobPriority::Background);
                         }
                         else
                         {
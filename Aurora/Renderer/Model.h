@@ -52,6 +52,7 @@ namespace Aurora
         // Buffers
         DX11_VertexBuffer* GetVertexBuffer() const { return m_VertexBuffer.get(); }
         DX11_IndexBuffer* GetIndexBuffer() const { return m_IndexBuffer.get(); }
+        Mesh* GetMesh() const { return m_Mesh.get(); }
 
     public:
         bool CreateBuffers();
@@ -77,6 +77,10 @@ namespace Aurora
         m_DirectionalLight->SetEntityName("Directional Light");
         m_DirectionalLight->m_Transform->Translate({ 0.01, 4, 0 });
 
+        m_LightQuery = &m_EngineContext->GetSubsystem<World>()->GetEntityQuery<Light>();
+        m_RenderableQuery = &m_EngineContext->GetSubsystem<World>()->GetEntityQuery<Renderable>();
+        m_AudioSourceQuery = &m_EngineContext->GetSubsystem<World>()->GetEntityQuery<AudioSource>();
+
         // For scissor rects in our rasterizer set.
         D3D11_RECT pRects[8];
         for (uint32_t i = 0; i < 8; ++i)
@@ -188,20 +192,18 @@ namespace Aurora
 
     void Renderer::UpdateLightConstantBuffer() // We can only bind up to 16 point lights at this time.
     {
-        std::vector<std::shared_ptr<Entity>> lightEntities;
-        for (std::shared_ptr<Entity> entity : m_SceneEntities)
+        ConstantBufferData_Frame miscConstantBuffer;
+        constexpr size_t maximumLightCount = std::size(miscConstantBuffer.g_Light_Position);
+
+        std::vector<Entity*> lightEntities;
+        for (Entity* entity : m_LightQuery->GetEntities())
         {
-            if (entity->IsActive())
+            if (entity->IsActive() && lightEntities.size() < maximumLightCount)
             {
-                if (entity->HasComponent<Light>())
-                {
-                    lightEntities.push_back(entity);
-                }
+                lightEntities.push_back(entity);
             }
         }
 
-        ConstantBufferData_Frame miscConstantBuffer;
-
         // Our Ortho Projection Matrix for Directional Light Source Modelling
         float nearPlane = 1.0f, farPlane = 50.0f;
 
@@ -280,6 +282,14 @@ namespace Aurora
             UpdateCameraConstantBuffer(m_Camera, 0);
         }
 
+        // Shadows may be cast from outside of our view, hence only the bloom and scene passes are culled.
+        m_VisibleRenderables.clear();
+        if (m_Camera != nullptr)
+        {
+            const Camera* camera = m_Camera->GetComponent<Camera>();
+            m_EngineContext->GetSubsystem<World>()->QueryEntitiesInFrustum(camera->GetViewMatrix() * camera->GetProjectionMatrix(), &m_VisibleRenderables);
+        }
+
         ID3D11SamplerState* samplerState = DX11_Utility::ToInternal(&m_Standard_Texture_Sampler)->m_Resource.Get();
         ID3D11SamplerState* samplerState2 = DX11_Utility::ToInternal(&m_Depth_Texture_Sampler)->m_Resource.Get();
         m_GraphicsDevice->m_DeviceContextImmediate->PSSetSamplers(0, 1, &samplerState);
@@ -287,9 +297,6 @@ namespace Aurora
         m_GraphicsDevice->m_DeviceContextImmediate->PSSetSamplers(3, 1, m_Skybox->m_DefaultSampler->GetSampler().GetAddressOf());
         m_GraphicsDevice->m_DeviceContextImmediate->PSSetSamplers(4, 1, m_Skybox->m_SpecularBRDFSampler->GetSampler().GetAddressOf());
 
-        // Retrieve Scene Entities
-        m_SceneEntities = m_EngineContext->GetSubsystem<World>()->EntityGetAll();
-
 
         //============== Depth Buffer Pass ==================
         m_GraphicsDevice->BindPipelineState(&m_PSO_Object_Wire, 0);
@@ -304,7 +311,7 @@ namespace Aurora
         m_GraphicsDevice->m_DeviceContextImmediate->OMSetRenderTargets(0, nullptr, m_DeviceContext->m_ShadowDepthTexture->GetDepthStencilView().Get());
         m_GraphicsDevice->m_DeviceContextImmediate->ClearDepthStencilView(m_DeviceContext->m_ShadowDepthTexture->GetDepthStencilView().Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 
-        RenderScene();
+        RenderScene(m_RenderableQuery->GetEntities());
 
         // ============= Bloom Extraction Pass =================== 
         // Bloom Threashold and stuff
@@ -320,7 +327,7 @@ namespace Aurora
         m_GraphicsDevice->m_DeviceContextImmediate->ClearRenderTargetView(m_DeviceContext->m_BloomRenderTexture->GetRenderTargetView().Get(), color);
         m_GraphicsDevice->m_DeviceContextImmediate->ClearDepthStencilView(m_DeviceContext->m_DummyDepthTexture->GetDepthStencilView().Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 
-        RenderScene();
+        RenderScene(m_VisibleRenderables);
 
         /*
         // ============ Blur Pass ==================
@@ -350,7 +357,7 @@ namespace Aurora
         m_GraphicsDevice->m_DeviceContextImmediate->ClearDepthStencilView(m_DeviceContext->m_MultisampleFramebuffer->m_DepthStencilTexture->GetDepthStencilView().Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 
         ///==============================
-        RenderScene();
+        RenderScene(m_VisibleRenderables);
         m_Skybox->Render();
         DrawDebugWorld(m_Camera);
         Pass_Lines();
@@ -372,18 +379,15 @@ namespace Aurora
         TickPrimitives(deltaTime);
     }
 
-    void Renderer::RenderScene()
+    void Renderer::RenderScene(const std::vector<Entity*>& renderableEntities)
     {
         m_GraphicsDevice->BindConstantBuffer(RHI_Shader_Stage::Vertex_Shader, &g_ConstantBuffers[CB_Types::CB_Entity], CB_GETBINDSLOT(ConstantBufferData_Entity), 0);
 
         /// Render Queue Feature?
-        auto& sceneEntities = m_EngineContext->GetSubsystem<World>()->EntityGetAll();
-        
-        for (const auto& entity : sceneEntities)
+        for (Entity* entity : renderableEntities)
         {
             // Renderable
             Renderable* renderable = entity->GetComponent<Renderable>();
-            if (!renderable) { continue; }
 
             Material* material = renderable->GetMaterial();
             if (!material) { continue; }
@@ -397,7 +401,7 @@ namespace Aurora
             Transform* transform = entity->GetTransform();
             if (!transform) { continue; }
 
-            UpdateEntityConstantBuffer(entity.get());
+            UpdateEntityConstantBuffer(entity);
 
             m_DeviceContext->BindVertexBuffer(model->GetVertexBuffer());
             m_DeviceContext->BindIndexBuffer(model->GetIndexBuffer());
@@ -577,33 +581,35 @@ namespace Aurora
     {
         Stopwatch stopwatch("Icons Pass", true);
 
-        // Render Queue Feature?
-        auto& sceneEntities = m_EngineContext->GetSubsystem<World>()->EntityGetAll();
+        // Gather the entities with icons from our queries, rather than looking through every entity in the world. Lights take precedence over audio sources.
+        std::vector<std::pair<Entity*, DX11_Texture*>> gizmoEntities;
+        gizmoEntities.reserve(m_LightQuery->GetCount() + m_AudioSourceQuery->GetCount() + 1);
 
-        for (const auto& entity : sceneEntities)
+        for (Entity* entity : m_LightQuery->GetEntities())
         {
-            DX11_Texture* gizmosToRender;
+            gizmoEntities.emplace_back(entity, m_GizmosPointLightTexture.get());
+        }
 
-            if (entity->GetComponent<Light>())
-            {
-                gizmosToRender = m_GizmosPointLightTexture.get();
-            }
-            else if (entity->GetComponent<AudioSource>())
-            {
-                gizmosToRender = m_GizmosAudioSourceTexture.get();
-            }
-            //else if (entity->GetComponent<Camera>()) // For game camera.
-            //{
-            //    gizmosToRender = m_GizmosCameraTexture.get();
-            //}
-            else if (entity->GetObjectName() == "Directional Light") // To combine with Light component.
-            {
-                gizmosToRender = m_GizmosDirectionalLightTexture.get();
-            }
-            else
+        for (Entity* entity : m_AudioSourceQuery->GetEntities())
+        {
+            if (!entity->HasComponent<Light>())
             {
-                continue;
+                gizmoEntities.emplace_back(entity, m_GizmosAudioSourceTexture.get());
             }
+        }
+
+        //for (Entity* entity : m_CameraQuery->GetEntities()) // For game camera.
+        //{
+        //    gizmoEntities.emplace_back(entity, m_GizmosCameraTexture.get());
+        //}
+
+        if (!m_DirectionalLight->HasComponent<Light>() && !m_DirectionalLight->HasComponent<AudioSource>()) // To combine with Light component.
+        {
+            gizmoEntities.emplace_back(m_DirectionalLight.get(), m_GizmosDirectionalLightTexture.get());
+        }
+
+        for (const auto& [entity, gizmosToRender] : gizmoEntities)
+        {
 
             // Set render state.
             m_DeviceContext->BindRasterizerState(RasterizerState_Types::RasterizerState_CullBackSolid);
@@ -19,6 +19,7 @@ namespace Aurora
 {
     class Skybox;
     class ResourceCache;
+    class EntityQuery;
 
     class Renderer : public ISubsystem
     {
@@ -52,7 +53,7 @@ namespace Aurora
         void Tick(float deltaTime) override;
 
         // ===========================
-        void RenderScene();
+        void RenderScene(const std::vector<Entity*>& renderableEntities);
         void DrawDebugWorld(Entity* entity);
         void Pass_Icons();
 
@@ -148,8 +149,11 @@ namespace Aurora
         RHI_Shader m_CopyBilinearPixelShader;
         std::shared_ptr<DX11_InputLayout> m_PixelInputLayout;
 
-        // Entities
-        std::vector<std::shared_ptr<Entity>> m_SceneEntities;
+        // Entities - Kept up to date by the world as components come and go.
+        EntityQuery* m_LightQuery = nullptr;
+        EntityQuery* m_RenderableQuery = nullptr;
+        EntityQuery* m_AudioSourceQuery = nullptr;
+        std::vector<Entity*> m_VisibleRenderables; // Within our camera's frustum, gathered from the world's spatial index every frame.
 
         RHI_PipelineState m_PSO_Object_Wire; // Right now we're using this for everything.
     };
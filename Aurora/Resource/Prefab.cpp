@@ -11,7 +11,9 @@ namespace Aurora
 
     void Prefab::AppendToPrefab(Entity* entity)
     {
+        // Only the new hierarchy is captured, so building a prefab from many appends stays linear.
         m_PrefabEntities.emplace_back(entity);
+        m_Template.Append(entity);
     }
 
     bool Prefab::SaveToFile(const std::string& filePath)
@@ -34,6 +36,9 @@ namespace Aurora
             return false;
         }
 
+        // Our entities may have changed since being appended. Capture them anew alongside writing them, so that instances match what is on disk.
+        m_Template.Capture(m_PrefabEntities);
+
         // Save root entities as this will also save their descendants.
         fileSerializer->Write(static_cast<uint32_t>(m_PrefabEntities.size()));
 
@@ -70,7 +75,7 @@ namespace Aurora
             // Load root entity count.
             const uint32_t rootEntityCount = binaryDeserializer->ReadAs<uint32_t>();
 
-            std::vector<uint32_t> entityIDs;
+            std::vector<Entity*> rootEntities;
 
             // Deserialize root entities.
             for (uint32_t i = 0; i < rootEntityCount; i++)
@@ -85,8 +90,13 @@ namespace Aurora
                     child->GetEntity()->SetObjectID(child->GetEntity()->GenerateObjectID());
                 }
 
+                rootEntities.emplace_back(entity.get());
+
                 /// Tracker.
             }
+
+            // Further instances are created from memory.
+            m_Template.Capture(rootEntities);
         }
         else
         {
@@ -1,7 +1,9 @@
 #pragma once
 #include "AuroraResource.h"
+#include "../Scene/PrefabTemplate.h"
 
-// Prefabs are essentially "boxes" around various entities. It comes with the entities, arranged in whatever way we put them in the box.
+// Prefabs are essentially "boxes" around various entities. It comes with the entities, arranged in whatever way we put them in the box. Each prefab keeps a template of
+// its entities in memory too, from which further instances are created through World::Instantiate without reading the file again.
 
 namespace Aurora
 {
@@ -15,8 +17,11 @@ namespace Aurora
         bool SaveToFile(const std::string& filePath) override;
         bool LoadFromFile(const std::string& filePath) override;
 
+        const PrefabTemplate& GetTemplate() const { return m_Template; }
+
     private:
         // A prefab is essentially made up of entities with its own component data, including transforms, meshs amongst others.
         std::vector<Entity*> m_PrefabEntities;
+        PrefabTemplate m_Template;
     };
 }
\ No newline at end of file
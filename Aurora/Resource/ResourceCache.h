@@ -32,6 +32,7 @@ namespace Aurora
         ~ResourceCache();
 
         bool Initialize() override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_None, false }; } // We don't tick.
         
         // =========================================================================================================
 
@@ -0,0 +1,294 @@
+#include "Aurora.h"
+#include "BoundingVolumeHierarchy.h"
+
+namespace Aurora
+{
+    static BoundingBox MergeBounds(const BoundingBox& boundsA, const BoundingBox& boundsB)
+    {
+        BoundingBox mergedBounds = boundsA;
+        mergedBounds.Merge(boundsB);
+        return mergedBounds;
+    }
+
+    uint32_t BoundingVolumeHierarchy::Insert(const BoundingBox& bounds, uint32_t userValue)
+    {
+        const uint32_t proxyID = AllocateNode();
+        m_Nodes[proxyID].m_Bounds = bounds.Expanded(m_FatMargin);
+        m_Nodes[proxyID].m_UserValue = userValue;
+        m_Nodes[proxyID].m_Height = 0;
+
+        InsertLeaf(proxyID);
+        m_ProxyCount++;
+
+        return proxyID;
+    }
+
+    void BoundingVolumeHierarchy::Remove(uint32_t proxyID)
+    {
+        RemoveLeaf(proxyID);
+        FreeNode(proxyID);
+        m_ProxyCount--;
+    }
+
+    bool BoundingVolumeHierarchy::Move(uint32_t proxyID, const BoundingBox& bounds)
+    {
+        if (m_Nodes[proxyID].m_Bounds.IsInside(bounds) == Intersection::Inside)
+        {
+            return false;
+        }
+
+        RemoveLeaf(proxyID);
+        m_Nodes[proxyID].m_Bounds = bounds.Expanded(m_FatMargin);
+        InsertLeaf(proxyID);
+
+        return true;
+    }
+
+    void BoundingVolumeHierarchy::Clear()
+    {
+        m_Nodes.clear();
+        m_RootNode = m_InvalidNode;
+        m_FreeNode = m_InvalidNode;
+        m_ProxyCount = 0;
+    }
+
+    uint32_t BoundingVolumeHierarchy::AllocateNode()
+    {
+        if (m_FreeNode == m_InvalidNode)
+        {
+            m_Nodes.emplace_back();
+            return static_cast<uint32_t>(m_Nodes.size() - 1);
+        }
+
+        const uint32_t nodeIndex = m_FreeNode;
+        m_FreeNode = m_Nodes[nodeIndex].m_Parent;
+        m_Nodes[nodeIndex] = Node();
+
+        return nodeIndex;
+    }
+
+    void BoundingVolumeHierarchy::FreeNode(uint32_t nodeIndex)
+    {
+        m_Nodes[nodeIndex].m_Parent = m_FreeNode;
+        m_Nodes[nodeIndex].m_Height = -1;
+        m_FreeNode = nodeIndex;
+    }
+
+    void BoundingVolumeHierarchy::InsertLeaf(uint32_t leafIndex)
+    {
+        if (m_RootNode == m_InvalidNode)
+        {
+            m_RootNode = leafIndex;
+            m_Nodes[leafIndex].m_Parent = m_InvalidNode;
+            return;
+        }
+
+        // Descend towards the best sibling for our leaf. Pairing with a node costs the area of their merged bounds, and every ancestor of that node grows too.
+        const BoundingBox leafBounds = m_Nodes[leafIndex].m_Bounds;
+        uint32_t siblingIndex = m_RootNode;
+
+        while (!m_Nodes[siblingIndex].IsLeaf())
+        {
+            const Node& node = m_Nodes[siblingIndex];
+            const float mergedArea = MergeBounds(node.m_Bounds, leafBounds).GetSurfaceArea();
+
+            const float pairingCost = 2.0f * mergedArea;                                    // Pairing with this node.
+            const float inheritedCost = 2.0f * (mergedArea - node.m_Bounds.GetSurfaceArea()); // What this node grows by should we descend further.
+
+            float childCosts[2];
+            for (uint32_t i = 0; i < 2; i++)
+            {
+                const Node& child = m_Nodes[node.m_Children[i]];
+                const float childMergedArea = MergeBounds(child.m_Bounds, leafBounds).GetSurfaceArea();
+                childCosts[i] = (child.IsLeaf() ? childMergedArea : childMergedArea - child.m_Bounds.GetSurfaceArea()) + inheritedCost;
+            }
+
+            if (pairingCost < childCosts[0] && pairingCost < childCosts[1])
+            {
+                break;
+            }
+
+            siblingIndex = childCosts[0] < childCosts[1] ? node.m_Children[0] : node.m_Children[1];
+        }
+
+        // Replace the sibling with a new parent holding both it and our leaf.
+        const uint32_t oldParentIndex = m_Nodes[siblingIndex].m_Parent;
+        const uint32_t newParentIndex = AllocateNode();
+
+        Node& newParent = m_Nodes[newParentIndex];
+        newParent.m_Parent = oldParentIndex;
+        newParent.m_Bounds = MergeBounds(leafBounds, m_Nodes[siblingIndex].m_Bounds);
+        newParent.m_Height = m_Nodes[siblingIndex].m_Height + 1;
+        newParent.m_Children[0] = siblingIndex;
+        newParent.m_Children[1] = leafIndex;
+
+        if (oldParentIndex != m_InvalidNode)
+        {
+            Node& oldParent = m_Nodes[oldParentIndex];
+            oldParent.m_Children[oldParent.m_Children[0] == siblingIndex ? 0 : 1] = newParentIndex;
+        }
+        else
+        {
+            m_RootNode = newParentIndex;
+        }
+
+        m_Nodes[siblingIndex].m_Parent = newParentIndex;
+        m_Nodes[leafIndex].m_Parent = newParentIndex;
+
+        RefitAncestors(m_Nodes[leafIndex].m_Parent);
+    }
+
+    void BoundingVolumeHierarchy::RemoveLeaf(uint32_t leafIndex)
+    {
+        if (leafIndex == m_RootNode)
+        {
+            m_RootNode = m_InvalidNode;
+            return;
+        }
+
+        // Our sibling takes our parent's place.
+        const uint32_t parentIndex = m_Nodes[leafIndex].m_Parent;
+        const uint32_t grandParentIndex = m_Nodes[parentIndex].m_Parent;
+        const uint32_t siblingIndex = m_Nodes[parentIndex].m_Children[0] == leafIndex ? m_Nodes[parentIndex].m_Children[1] : m_Nodes[parentIndex].m_Children[0];
+
+        if (grandParentIndex != m_InvalidNode)
+        {
+            Node& grandParent = m_Nodes[grandParentIndex];
+            grandParent.m_Children[grandParent.m_Children[0] == parentIndex ? 0 : 1] = siblingIndex;
+            m_Nodes[siblingIndex].m_Parent = grandParentIndex;
+            FreeNode(parentIndex);
+
+            RefitAncestors(grandParentIndex);
+        }
+        else
+        {
+            m_RootNode = siblingIndex;
+            m_Nodes[siblingIndex].m_Parent = m_InvalidNode;
+            FreeNode(parentIndex);
+        }
+    }
+
+    void BoundingVolumeHierarchy::RefitAncestors(uint32_t nodeIndex)
+    {
+        while (nodeIndex != m_InvalidNode)
+        {
+            nodeIndex = Balance(nodeIndex);
+
+            Node& node = m_Nodes[nodeIndex];
+            const Node& childA = m_Nodes[node.m_Children[0]];
+            const Node& childB = m_Nodes[node.m_Children[1]];
+
+            node.m_Height = 1 + std::max(childA.m_Height, childB.m_Height);
+            node.m_Bounds = MergeBounds(childA.m_Bounds, childB.m_Bounds);
+
+            nodeIndex = node.m_Parent;
+        }
+    }
+
+    // Should one child of the node be more than a level taller than the other, the taller child is rotated up into the node's place. The node then takes the taller
+    // child's shorter child, with the taller child's taller child staying put.
+    uint32_t BoundingVolumeHierarchy::Balance(uint32_t nodeIndexA)
+    {
+        Node& nodeA = m_Nodes[nodeIndexA];
+        if (nodeA.IsLeaf() || nodeA.m_Height < 2)
+        {
+            return nodeIndexA;
+        }
+
+        const int32_t balance = m_Nodes[nodeA.m_Children[1]].m_Height - m_Nodes[nodeA.m_Children[0]].m_Height;
+        if (balance >= -1 && balance <= 1)
+        {
+            return nodeIndexA;
+        }
+
+        // The taller child, rising, and the shorter one, staying with A.
+        const uint32_t risingSide = balance > 1 ? 1 : 0;
+        const uint32_t nodeIndexRising = nodeA.m_Children[risingSide];
+        const uint32_t nodeIndexStaying = nodeA.m_Children[1 - risingSide];
+        Node& nodeRising = m_Nodes[nodeIndexRising];
+        const Node& nodeStaying = m_Nodes[nodeIndexStaying];
+
+        // The rising node's children. The taller stays with it, and the shorter goes to A.
+        const uint32_t nodeIndexF = nodeRising.m_Children[0];
+        const uint32_t nodeIndexG = nodeRising.m_Children[1];
+        const bool isTallerF = m_Nodes[nodeIndexF].m_Height > m_Nodes[nodeIndexG].m_Height;
+        const uint32_t nodeIndexKept = isTallerF ? nodeIndexF : nodeIndexG;
+        const uint32_t nodeIndexGiven = isTallerF ? nodeIndexG : nodeIndexF;
+
+        // The rising node takes A's place under A's parent.
+        nodeRising.m_Parent = nodeA.m_Parent;
+        nodeA.m_Parent = nodeIndexRising;
+        if (nodeRising.m_Parent != m_InvalidNode)
+        {
+            Node& parent = m_Nodes[nodeRising.m_Parent];
+            parent.m_Children[parent.m_Children[0] == nodeIndexA ? 0 : 1] = nodeIndexRising;
+        }
+        else
+        {
+            m_RootNode = nodeIndexRising;
+        }
+
+        // A becomes a child of the rising node, and adopts its given child in the rising node's old place.
+        nodeRising.m_Children[0] = nodeIndexA;
+        nodeRising.m_Children[1] = nodeIndexKept;
+        nodeA.m_Children[risingSide] = nodeIndexGiven;
+        m_Nodes[nodeIndexGiven].m_Parent = nodeIndexA;
+
+        nodeA.m_Bounds = MergeBounds(nodeStaying.m_Bounds, m_Nodes[nodeIndexGiven].m_Bounds);
+        nodeA.m_Height = 1 + std::max(nodeStaying.m_Height, m_Nodes[nodeIndexGiven].m_Height);
+        nodeRising.m_Bounds = MergeBounds(nodeA.m_Bounds, m_Nodes[nodeIndexKept].m_Bounds);
+        nodeRising.m_Height = 1 + std::max(nodeA.m_Height, m_Nodes[nodeIndexKept].m_Height);
+
+        return nodeIndexRising;
+    }
+
+    float BoundingVolumeHierarchy::GetDistanceSquared(const BoundingBox& bounds, const Vector3& point)
+    {
+        const Vector3 closestPoint(
+            Helper::Clamp(point.x, bounds.GetMinimum().x, bounds.GetMaximum().x),
+            Helper::Clamp(point.y, bounds.GetMinimum().y, bounds.GetMaximum().y),
+            Helper::Clamp(point.z, bounds.GetMinimum().z, bounds.GetMaximum().z)
+        );
+
+        return Vector3::DistanceSquared(closestPoint, point);
+    }
+
+    void BoundingVolumeHierarchy::ExtractFrustumPlanes(const XMMATRIX& viewProjectionMatrix, XMFLOAT4 frustumPlanes[6])
+    {
+        XMFLOAT4X4 matrix;
+        XMStoreFloat4x4(&matrix, viewProjectionMatrix);
+
+        // Points transform as row vectors, hence each clip space coordinate is a column of the matrix. A point lies within a plane's half space when its dot product with
+        // the plane is positive - for the left plane, x >= -w.
+        const XMFLOAT4 columnX(matrix._11, matrix._21, matrix._31, matrix._41);
+        const XMFLOAT4 columnY(matrix._12, matrix._22, matrix._32, matrix._42);
+        const XMFLOAT4 columnZ(matrix._13, matrix._23, matrix._33, matrix._43);
+        const XMFLOAT4 columnW(matrix._14, matrix._24, matrix._34, matrix._44);
+
+        frustumPlanes[0] = XMFLOAT4(columnW.x + columnX.x, columnW.y + columnX.y, columnW.z + columnX.z, columnW.w + columnX.w); // Left
+        frustumPlanes[1] = XMFLOAT4(columnW.x - columnX.x, columnW.y - columnX.y, columnW.z - columnX.z, columnW.w - columnX.w); // Right
+        frustumPlanes[2] = XMFLOAT4(columnW.x + columnY.x, columnW.y + columnY.y, columnW.z + columnY.z, columnW.w + columnY.w); // Bottom
+        frustumPlanes[3] = XMFLOAT4(columnW.x - columnY.x, columnW.y - columnY.y, columnW.z - columnY.z, columnW.w - columnY.w); // Top
+        frustumPlanes[4] = columnZ;                                                                                             // Near
+        frustumPlanes[5] = XMFLOAT4(columnW.x - columnZ.x, columnW.y - columnZ.y, columnW.z - columnZ.z, columnW.w - columnZ.w); // Far
+    }
+
+    bool BoundingVolumeHierarchy::IsInsideFrustum(const BoundingBox& bounds, const XMFLOAT4 frustumPlanes[6])
+    {
+        // Bounds are outside once the corner furthest along a plane's normal is behind it.
+        for (uint32_t i = 0; i < 6; i++)
+        {
+            const XMFLOAT4& plane = frustumPlanes[i];
+            const float furthestX = plane.x >= 0.0f ? bounds.GetMaximum().x : bounds.GetMinimum().x;
+            const float furthestY = plane.y >= 0.0f ? bounds.GetMaximum().y : bounds.GetMinimum().y;
+            const float furthestZ = plane.z >= 0.0f ? bounds.GetMaximum().z : bounds.GetMinimum().z;
+
+            if (plane.x * furthestX + plane.y * furthestY + plane.z * furthestZ + plane.w < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+#include "../Math/XM_Utilities/BoundingBox.h"
+#include "../Math/XM_Utilities/Ray.h"
+
+/* == Bounding Volume Hierarchy ==
+
+    A dynamic tree of axis-aligned bounding boxes, used by the World to find entities by where they are rather than by testing every one of them. Each leaf holds a proxy:
+    the bounds of an object (grown by a margin) and a value identifying it. Every internal node encloses its two children, so queries skip any subtree whose bounds they
+    miss, costing O(log n) plus the number of hits.
+
+    - Insertion descends towards the sibling which grows the tree's total surface area the least, and removal collapses the leaf's parent. Both rebalance the nodes above
+      through rotations, keeping the tree's height logarithmic however objects come and go.
+    - Proxies are kept "fat", enclosing their objects with a margin to spare. Moving an object only reinserts its proxy once it leaves those bounds, so objects jittering
+      in place or moving slowly rarely touch the tree.
+
+    Nodes live in a single array and refer to one another by index, with removed nodes chained into a free list for reuse. Proxy IDs are node indices, and remain valid
+    until removed. Queries are const and may run concurrently with one another, but not with modifications.
+*/
+
+namespace Aurora
+{
+    class BoundingVolumeHierarchy
+    {
+    public:
+        static constexpr uint32_t m_InvalidProxy = ~0u;
+
+        // Inserts a proxy for the given bounds, returning its ID.
+        uint32_t Insert(const BoundingBox& bounds, uint32_t userValue);
+        void Remove(uint32_t proxyID);
+        // Updates the bounds of a proxy. Returns whether the tree had to change, which is only the case once the bounds leave the proxy's fat bounds.
+        bool Move(uint32_t proxyID, const BoundingBox& bounds);
+        void Clear();
+
+        uint32_t GetUserValue(uint32_t proxyID) const { return m_Nodes[proxyID].m_UserValue; }
+        const BoundingBox& GetFatBounds(uint32_t proxyID) const { return m_Nodes[proxyID].m_Bounds; }
+        uint32_t GetProxyCount() const { return m_ProxyCount; }
+        uint32_t GetHeight() const { return m_RootNode == m_InvalidNode ? 0 : static_cast<uint32_t>(m_Nodes[m_RootNode].m_Height); }
+
+        // == Queries ==
+        // Each invokes callback(userValue) for every proxy whose fat bounds pass the test, in no particular order. Being fat, these may slightly exceed the objects.
+        // Test against the exact bounds where it matters.
+
+        template<typename Callback>
+        void QueryBox(const BoundingBox& bounds, Callback&& callback) const
+        {
+            Traverse([&bounds](const BoundingBox& nodeBounds) { return nodeBounds.IsInside(bounds) != Intersection::Outside; }, callback);
+        }
+
+        template<typename Callback>
+        void QuerySphere(const Vector3& center, float radius, Callback&& callback) const
+        {
+            Traverse([&center, radius](const BoundingBox& nodeBounds) { return GetDistanceSquared(nodeBounds, center) <= radius * radius; }, callback);
+        }
+
+        // The frustum is taken from a view projection matrix, with depth ranging from 0 to 1.
+        template<typename Callback>
+        void QueryFrustum(const XMMATRIX& viewProjectionMatrix, Callback&& callback) const
+        {
+            XMFLOAT4 frustumPlanes[6];
+            ExtractFrustumPlanes(viewProjectionMatrix, frustumPlanes);
+
+            Traverse([&frustumPlanes](const BoundingBox& nodeBounds) { return IsInsideFrustum(nodeBounds, frustumPlanes); }, callback);
+        }
+
+        // Invokes callback(userValue, hitDistance) for every proxy whose fat bounds the ray hits within its length.
+        template<typename Callback>
+        void QueryRay(const Ray& ray, Callback&& callback) const
+        {
+            uint32_t nodeStack[m_MaximumStackSize];
+            uint32_t stackSize = 0;
+
+            if (m_RootNode != m_InvalidNode)
+            {
+                nodeStack[stackSize++] = m_RootNode;
+            }
+
+            while (stackSize > 0)
+            {
+                const Node& node = m_Nodes[nodeStack[--stackSize]];
+                const float hitDistance = ray.HitDistance(node.m_Bounds);
+                if (hitDistance > ray.GetLength())
+                {
+                    continue;
+                }
+
+                if (node.IsLeaf())
+                {
+                    callback(node.m_UserValue, hitDistance);
+                }
+                else
+                {
+                    nodeStack[stackSize++] = node.m_Children[0];
+                    nodeStack[stackSize++] = node.m_Children[1];
+                }
+            }
+        }
+
+    private:
+        static constexpr uint32_t m_InvalidNode = ~0u;
+        static constexpr float m_FatMargin = 0.1f;
+        static constexpr uint32_t m_MaximumStackSize = 128; // Our height stays logarithmic, hence this suffices for far more proxies than we could ever hold.
+
+        struct Node
+        {
+            bool IsLeaf() const { return m_Children[0] == m_InvalidNode; }
+
+            BoundingBox m_Bounds;
+            uint32_t m_Parent = m_InvalidNode;                        // The next free node whilst on our free list.
+            uint32_t m_Children[2] = { m_InvalidNode, m_InvalidNode };
+            int32_t m_Height = 0;                                     // 0 for leaves, -1 for free nodes.
+            uint32_t m_UserValue = 0;
+        };
+
+        template<typename Test, typename Callback>
+        void Traverse(Test&& test, Callback&& callback) const
+        {
+            uint32_t nodeStack[m_MaximumStackSize];
+            uint32_t stackSize = 0;
+
+            if (m_RootNode != m_InvalidNode)
+            {
+                nodeStack[stackSize++] = m_RootNode;
+            }
+
+            while (stackSize > 0)
+            {
+                const Node& node = m_Nodes[nodeStack[--stackSize]];
+                if (!test(node.m_Bounds))
+                {
+                    continue;
+                }
+
+                if (node.IsLeaf())
+                {
+                    callback(node.m_UserValue);
+                }
+                else
+                {
+                    nodeStack[stackSize++] = node.m_Children[0];
+                    nodeStack[stackSize++] = node.m_Children[1];
+                }
+            }
+        }
+
+        uint32_t AllocateNode();
+        void FreeNode(uint32_t nodeIndex);
+        void InsertLeaf(uint32_t leafIndex);
+        void RemoveLeaf(uint32_t leafIndex);
+        void RefitAncestors(uint32_t nodeIndex); // Rebalances and refits from the given node up to our root.
+        uint32_t Balance(uint32_t nodeIndex);    // Returns the index of the node now in the given one's place.
+
+        static float GetDistanceSquared(const BoundingBox& bounds, const Vector3& point);
+        static void ExtractFrustumPlanes(const XMMATRIX& viewProjectionMatrix, XMFLOAT4 frustumPlanes[6]);
+        static bool IsInsideFrustum(const BoundingBox& bounds, const XMFLOAT4 frustumPlanes[6]);
+
+    private:
+        std::vector<Node> m_Nodes;
+        uint32_t m_RootNode = m_InvalidNode;
+        uint32_t m_FreeNode = m_InvalidNode;
+        uint32_t m_ProxyCount = 0;
+    };
+}
@@ -0,0 +1,214 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Components/IComponent.h"
+
+/* == Component Storage ==
+
+    Rather than each entity owning its components through individual heap allocations, the World keeps one storage per component type. Components of the same type are
+    constructed into fixed size chunks, so they sit next to one another in memory. Chunks are never moved or freed while the storage lives, since components are referred to
+    through raw pointers all over the engine (the hierarchy, attributes capturing "this", the editor), and freed slots are recycled by later components of the same type.
+
+    Each storage is a sparse set keyed by entity slot index (see EntityHandle). The sparse array maps an entity to its position in the dense arrays, which hold every live
+    component and its owner back to back. Lookups are thus O(1), and passes over a single component type (ForEach) walk tightly packed arrays rather than chasing entity
+    pointers and scanning their component lists. Removal swaps the last element into the hole, keeping the dense arrays packed.
+
+    Entity::AddComponent/GetComponent/RemoveComponent remain the interface for gameplay code, and forward to the storages of the entity's World.
+*/
+
+namespace Aurora
+{
+    // Refers to an entity slot of a World. The generation is bumped whenever a slot is released, so handles to destroyed entities can be detected rather than silently
+    // referring to whichever entity reused the slot.
+    struct EntityHandle
+    {
+        bool IsValid() const { return m_Index != ~0u; }
+        bool operator==(const EntityHandle& otherHandle) const { return m_Index == otherHandle.m_Index && m_Generation == otherHandle.m_Generation; }
+        bool operator!=(const EntityHandle& otherHandle) const { return !(*this == otherHandle); }
+
+        uint32_t m_Index = ~0u;
+        uint32_t m_Generation = 0;
+    };
+
+    // The type erased half of a storage - the sparse set itself.
+    class IComponentStorage
+    {
+    public:
+        virtual ~IComponentStorage() = default;
+
+        virtual IComponent* GetComponent(uint32_t entityIndex) const = 0;
+        virtual void Remove(uint32_t entityIndex) = 0;
+
+        bool Contains(uint32_t entityIndex) const { return entityIndex < m_Sparse.size() && m_Sparse[entityIndex] != m_InvalidIndex; }
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_DenseEntities.size()); }
+        const std::vector<uint32_t>& GetEntityIndices() const { return m_DenseEntities; } // Owners of each dense component, in dense order.
+
+    protected:
+        static constexpr uint32_t m_InvalidIndex = ~0u;
+
+        uint32_t InsertDense(uint32_t entityIndex)
+        {
+            if (entityIndex >= m_Sparse.size())
+            {
+                m_Sparse.resize(static_cast<size_t>(entityIndex) + 1, m_InvalidIndex);
+            }
+
+            const uint32_t denseIndex = static_cast<uint32_t>(m_DenseEntities.size());
+            m_Sparse[entityIndex] = denseIndex;
+            m_DenseEntities.push_back(entityIndex);
+            return denseIndex;
+        }
+
+        // Swaps the last dense element into the removed one's place. Returns the dense index that was vacated, which the derived storage mirrors.
+        uint32_t RemoveDense(uint32_t entityIndex)
+        {
+            const uint32_t denseIndex = m_Sparse[entityIndex];
+            const uint32_t lastEntityIndex = m_DenseEntities.back();
+
+            m_DenseEntities[denseIndex] = lastEntityIndex;
+            m_Sparse[lastEntityIndex] = denseIndex;
+            m_DenseEntities.pop_back();
+            m_Sparse[entityIndex] = m_InvalidIndex;
+
+            return denseIndex;
+        }
+
+    protected:
+        std::vector<uint32_t> m_Sparse;        // Entity slot index to dense index.
+        std::vector<uint32_t> m_DenseEntities; // Dense index to entity slot index.
+    };
+
+    template<typename T>
+    class ComponentStorage : public IComponentStorage
+    {
+    public:
+        ~ComponentStorage() override
+        {
+            while (!m_DenseEntities.empty())
+            {
+                Remove(m_DenseEntities.back());
+            }
+        }
+
+        template<typename... Arguments>
+        T* Emplace(uint32_t entityIndex, Arguments&&... arguments)
+        {
+            if (Contains(entityIndex))
+            {
+                return Get(entityIndex);
+            }
+
+            const uint32_t slot = AllocateSlot();
+            T* component = new (GetSlotAddress(slot)) T(std::forward<Arguments>(arguments)...);
+
+            InsertDense(entityIndex);
+            m_DenseComponents.push_back(component);
+            m_DenseSlots.push_back(slot);
+
+            return component;
+        }
+
+        void Remove(uint32_t entityIndex) override
+        {
+            if (!Contains(entityIndex))
+            {
+                return;
+            }
+
+            const uint32_t denseIndex = m_Sparse[entityIndex];
+            T* component = m_DenseComponents[denseIndex];
+            const uint32_t slot = m_DenseSlots[denseIndex];
+
+            RemoveDense(entityIndex);
+            m_DenseComponents[denseIndex] = m_DenseComponents.back();
+            m_DenseComponents.pop_back();
+            m_DenseSlots[denseIndex] = m_DenseSlots.back();
+            m_DenseSlots.pop_back();
+
+            component->~T();
+            m_FreeSlots.push_back(slot);
+        }
+
+        T* Get(uint32_t entityIndex) const { return Contains(entityIndex) ? m_DenseComponents[m_Sparse[entityIndex]] : nullptr; }
+        IComponent* GetComponent(uint32_t entityIndex) const override { return Get(entityIndex); }
+
+        const std::vector<T*>& GetComponents() const { return m_DenseComponents; } // Every live component, in dense order.
+
+        // Invokes function(T&) on every live component.
+        template<typename Function>
+        void ForEach(Function&& function)
+        {
+            for (T* component : m_DenseComponents)
+            {
+                function(*component);
+            }
+        }
+
+    private:
+        static constexpr uint32_t m_ChunkCapacity = 128;
+
+        struct Chunk
+        {
+            alignas(T) unsigned char m_Storage[sizeof(T) * m_ChunkCapacity];
+        };
+
+        uint32_t AllocateSlot()
+        {
+            if (!m_FreeSlots.empty())
+            {
+                const uint32_t slot = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+                return slot;
+            }
+
+            if (m_UsedSlotCount == m_Chunks.size() * m_ChunkCapacity)
+            {
+                m_Chunks.emplace_back(std::make_unique<Chunk>());
+            }
+
+            return m_UsedSlotCount++;
+        }
+
+        void* GetSlotAddress(uint32_t slot)
+        {
+            return m_Chunks[slot / m_ChunkCapacity]->m_Storage + sizeof(T) * (slot % m_ChunkCapacity);
+        }
+
+    private:
+        std::vector<std::unique_ptr<Chunk>> m_Chunks;
+        std::vector<uint32_t> m_FreeSlots;   // Slots of removed components, reused before any new ones.
+        uint32_t m_UsedSlotCount = 0;        // Slots ever handed out. Everything past this in our last chunk is untouched.
+
+        std::vector<T*> m_DenseComponents;   // Parallel to m_DenseEntities.
+        std::vector<uint32_t> m_DenseSlots;  // As above. The chunk slot each component lives in.
+    };
+
+    // One storage per component type. Owned by the World.
+    class ComponentRegistry
+    {
+    public:
+        template<typename T>
+        void Register()
+        {
+            m_Storages[static_cast<uint32_t>(IComponent::TypeToEnum<T>())] = std::make_unique<ComponentStorage<T>>();
+        }
+
+        template<typename T>
+        ComponentStorage<T>& GetStorage() const
+        {
+            return static_cast<ComponentStorage<T>&>(*m_Storages[static_cast<uint32_t>(IComponent::TypeToEnum<T>())]);
+        }
+
+        IComponentStorage* GetStorage(ComponentType componentType) const
+        {
+            return componentType < ComponentType::Unknown ? m_Storages[static_cast<uint32_t>(componentType)].get() : nullptr;
+        }
+
+    private:
+        std::unique_ptr<IComponentStorage> m_Storages[static_cast<uint32_t>(ComponentType::Unknown)];
+    };
+}
@@ -82,6 +82,28 @@ namespace Aurora
                 m_ComponentAttributes[i].Setter(attributes[i].Getter());
             }
         }
+
+        // Snapshots of our attribute values, such as for prefab templates. Attributes register in the same order for every component of a type, so a snapshot of one
+        // may be applied to any other.
+        std::vector<std::any> GetAttributeValues() const
+        {
+            std::vector<std::any> attributeValues;
+            attributeValues.reserve(m_ComponentAttributes.size());
+            for (const ComponentAttribute& attribute : m_ComponentAttributes)
+            {
+                attributeValues.emplace_back(attribute.Getter());
+            }
+
+            return attributeValues;
+        }
+
+        void SetAttributeValues(const std::vector<std::any>& attributeValues)
+        {
+            for (uint32_t i = 0; i < static_cast<uint32_t>(m_ComponentAttributes.size()) && i < attributeValues.size(); i++)
+            {
+                m_ComponentAttributes[i].Setter(attributeValues[i]);
+            }
+        }
        
         // Entity
         Entity* GetEntity() const { return m_Entity; }
@@ -112,7 +134,13 @@ namespace Aurora
             attribute.Getter = std::move(Getter);
             attribute.Setter = std::move(Setter);
             attribute.Comparison = std::move(Comparison);
-            m_ComponentAttributes.emplace_back(attribute);
+
+            // Reserve for every attribute at once, rather than growing (and reallocating) with each one as the component is constructed.
+            if (m_ComponentAttributes.empty())
+            {
+                m_ComponentAttributes.reserve(m_ReservedAttributeCount);
+            }
+            m_ComponentAttributes.emplace_back(std::move(attribute));
         }
 
         // The type of our component.
@@ -125,6 +153,7 @@ namespace Aurora
         Entity* m_Entity = nullptr;
 
     private:
+        static constexpr uint32_t m_ReservedAttributeCount = 10; // Enough for any of our components. AudioSource registers the most.
         std::vector<ComponentAttribute> m_ComponentAttributes;
     };
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "Renderable.h"
 #include "../Renderer/Material.h"
 #include "../Renderer/Model.h"
+#include "../Renderer/Mesh.h"
+#include "../Entity.h"
 #include "../Resource/ResourceCache.h"
 #include "../Graphics/DX11_Refactored/DX11_Texture.h"
 
@@ -23,6 +25,7 @@ namespace Aurora
         AURORA_REGISTER_ATTRIBUTE_VALUE_VALUE(m_GeometryIndexSize, uint32_t);
         AURORA_REGISTER_ATTRIBUTE_VALUE_VALUE(m_GeometryVertexOffset, uint32_t);
         AURORA_REGISTER_ATTRIBUTE_VALUE_VALUE(m_GeometryVertexSize, uint32_t);
+        AURORA_REGISTER_ATTRIBUTE_VALUE_VALUE(m_LocalBounds, BoundingBox);
     }
 
     void Renderable::Serialize(BinarySerializer* binarySerializer)
@@ -53,7 +56,9 @@ namespace Aurora
         binaryDeserializer->Read(&modelFilePath);
 
         // Model might not exist if the scene was just loaded. Hence, we need to serialize the path of the model itself as well. We load path on entry.
-        if (!(m_Model = m_EngineContext->GetSubsystem<ResourceCache>()->GetResourceByName<Model>(modelName).get()))
+        // Renderables without a model write an empty path, and have nothing to load.
+        m_Model = nullptr;
+        if (!modelFilePath.empty() && !(m_Model = m_EngineContext->GetSubsystem<ResourceCache>()->GetResourceByName<Model>(modelName).get()))
         {
             m_Model = m_EngineContext->GetSubsystem<ResourceCache>()->Load<Model>(modelFilePath).get();
         }
@@ -62,6 +67,7 @@ namespace Aurora
         m_GeometryIndexSize = binaryDeserializer->ReadAs<uint32_t>();
         m_GeometryVertexOffset = binaryDeserializer->ReadAs<uint32_t>();
         m_GeometryVertexSize = binaryDeserializer->ReadAs<uint32_t>();
+        ComputeLocalBounds();
 
         // Material
         binaryDeserializer->Read(&m_IsUsingDefaultMaterial);
@@ -77,7 +83,8 @@ namespace Aurora
             binaryDeserializer->Read(&materialFilePath);
 
             // Material might not exist if the scene was just loaded. Hence, we need to serialize the path of the model itself as well. We load material on entry.        
-            if (!(m_Material = m_EngineContext->GetSubsystem<ResourceCache>()->GetResourceByName<Material>(materialName).get()))
+            m_Material = nullptr;
+            if (!materialFilePath.empty() && !(m_Material = m_EngineContext->GetSubsystem<ResourceCache>()->GetResourceByName<Material>(materialName).get()))
             {
                 m_Material = m_EngineContext->GetSubsystem<ResourceCache>()->Load<Material>(materialFilePath).get();
             }
@@ -92,6 +99,36 @@ namespace Aurora
         m_GeometryIndexSize = indexSize;
         m_GeometryIndexOffset = indexOffset;
         m_Model = model;
+
+        ComputeLocalBounds();
+    }
+
+    BoundingBox Renderable::GetWorldBounds() const
+    {
+        return m_LocalBounds.Transform(GetEntity()->GetTransform()->GetWorldMatrix());
+    }
+
+    void Renderable::ComputeLocalBounds()
+    {
+        if (m_Model && m_Model->GetMesh() && m_GeometryVertexSize > 0)
+        {
+            const std::vector<XMFLOAT3>& vertexPositions = m_Model->GetMesh()->GetVertexPositions();
+            const uint32_t vertexEnd = std::min(m_GeometryVertexOffset + m_GeometryVertexSize, static_cast<uint32_t>(vertexPositions.size()));
+
+            BoundingBox localBounds;
+            for (uint32_t i = m_GeometryVertexOffset; i < vertexEnd; i++)
+            {
+                localBounds.Merge(Vector3(vertexPositions[i].x, vertexPositions[i].y, vertexPositions[i].z));
+            }
+
+            if (localBounds.Defined())
+            {
+                m_LocalBounds = localBounds;
+            }
+        }
+
+        // Our world bounds changed shape, so have the World refit them alongside the next transform update.
+        GetEntity()->GetTransform()->SetDirty();
     }
 
     std::shared_ptr<Material> Renderable::SetMaterial(const std::shared_ptr<Material>& material)
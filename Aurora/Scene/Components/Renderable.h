@@ -1,5 +1,6 @@
 #pragma once
 #include "IComponent.h"
+#include "../Math/XM_Utilities/BoundingBox.h"
 
 namespace Aurora
 {
@@ -24,6 +25,10 @@ namespace Aurora
         uint32_t GetGeometryVerticesSize() const { return m_GeometryVertexSize; }
         uint32_t GetGeometryIndicesSize() const { return m_GeometryIndexSize; }
 
+        // Bounds - Computed from our geometry's vertices as it is set, and placed in the world by our transform. The World indexes these spatially.
+        const BoundingBox& GetLocalBounds() const { return m_LocalBounds; }
+        BoundingBox GetWorldBounds() const;
+
         // Material
         // Sets a material from memory (adds it to the resource cache by default).
         std::shared_ptr<Material> SetMaterial(const std::shared_ptr<Material>& material);
@@ -35,12 +40,16 @@ namespace Aurora
         Material* GetMaterial() const { return m_Material; }
         bool HasMaterial() const { return m_Material != nullptr; }
 
+    private:
+        void ComputeLocalBounds();
+
     private:
         std::string m_GeometryName;
         uint32_t m_GeometryIndexOffset;
         uint32_t m_GeometryVertexOffset;
         uint32_t m_GeometryVertexSize;
         uint32_t m_GeometryIndexSize;
+        BoundingBox m_LocalBounds = BoundingBox(Vector3(-0.5f), Vector3(0.5f)); // A unit cube until we have geometry.
 
         bool m_IsUsingDefaultMaterial = false;
 
@@ -1,6 +1,7 @@
 #include "Aurora.h"
 #include "Transform.h"
 #include "../Scene/World.h"
+#include "../Scene/TransformHierarchy.h"
 #include <iostream>
 #include "../Physics/PhysicsUtilities.h"
 
@@ -31,6 +32,22 @@ namespace Aurora
         SetDirty(false);
     }
 
+    void Transform::SetDirty(bool value)
+    {
+        if (!value)
+        {
+            m_Flags &= ~Transform_Flags::Transform_Flag_Dirty;
+            return;
+        }
+
+        if (!IsDirty() && m_Hierarchy)
+        {
+            m_Hierarchy->MarkDirty(m_HierarchyIndex);
+        }
+
+        m_Flags |= Transform_Flags::Transform_Flag_Dirty;
+    }
+
     void Transform::Serialize(BinarySerializer* binarySerializer)
     {
         binarySerializer->Write(m_TranslationLocal);
@@ -70,12 +87,11 @@ namespace Aurora
         // Compute world transform.
         if (!HasParentTransform())
         {
-            m_WorldMatrix = m_LocalMatrix;
+            StoreWorldMatrix(XMLoadFloat4x4(&m_LocalMatrix));
         }
         else
         {
-            XMMATRIX matrix = XMLoadFloat4x4(&m_LocalMatrix) * GetParentTransformMatrix();
-            XMStoreFloat4x4(&m_WorldMatrix, matrix);
+            StoreWorldMatrix(XMLoadFloat4x4(&m_LocalMatrix) * GetParentTransformMatrix());
         }
 
         // Update Children
@@ -141,52 +157,61 @@ namespace Aurora
 
     XMFLOAT3 Transform::GetPosition() const
     {
-        return *((XMFLOAT3*)&m_WorldMatrix._41);
+        return m_PositionWorld;
     }
 
     XMFLOAT4 Transform::GetRotation() const
     {
-        XMFLOAT4 rotationLocal;
-        XMStoreFloat4(&rotationLocal, GetRotationVector());
-
-        return rotationLocal;
+        return m_RotationWorld;
     }
 
     XMFLOAT3 Transform::GetScale() const
     {
-        XMFLOAT3 scaleLocal;
-        XMStoreFloat3(&scaleLocal, GetScaleVector());
-        return scaleLocal;
+        return m_ScaleWorld;
     }
 
     XMVECTOR Transform::GetPositionVector() const
     {
-        return XMLoadFloat3((XMFLOAT3*)&m_WorldMatrix._41);
+        return XMLoadFloat3(&m_PositionWorld);
     }
 
     XMVECTOR Transform::GetRotationVector() const
     {
-        XMVECTOR scaleLocal, rotationLocal, translationLocal;
-        XMMatrixDecompose(&scaleLocal, &rotationLocal, &translationLocal, XMLoadFloat4x4(&m_WorldMatrix));
-
-        return rotationLocal;
+        return XMLoadFloat4(&m_RotationWorld);
     }
 
     XMVECTOR Transform::GetScaleVector() const
     {
-        XMVECTOR scaleLocal, rotationLocal, translationLocal;
-        XMMatrixDecompose(&scaleLocal, &rotationLocal, &translationLocal, XMLoadFloat4x4(&m_WorldMatrix));
-
-        return scaleLocal;
+        return XMLoadFloat3(&m_ScaleWorld);
     }
 
     XMMATRIX Transform::GetLocalMatrix() const
     {
-        XMVECTOR scaleLocal = XMLoadFloat3(&m_ScaleLocal);
-        XMVECTOR rotationLocal = XMLoadFloat4(&m_RotationLocal);
-        XMVECTOR translationLocal = XMLoadFloat3(&m_TranslationLocal);
-        
-        return XMMatrixScalingFromVector(scaleLocal) * (XMMatrixRotationX(m_RotationInRadians.x) * XMMatrixRotationY(m_RotationInRadians.y) * XMMatrixRotationZ(m_RotationInRadians.z)) * XMMatrixTranslationFromVector(translationLocal);
+        return ComposeLocalMatrix(m_ScaleLocal, m_RotationInRadians, m_TranslationLocal);
+    }
+
+    XMMATRIX Transform::ComposeLocalMatrix(const XMFLOAT3& scale, const XMFLOAT3& rotationInRadians, const XMFLOAT3& translation)
+    {
+        XMVECTOR sines, cosines;
+        XMVectorSinCos(&sines, &cosines, XMLoadFloat3(&rotationInRadians));
+
+        XMFLOAT3 sine, cosine;
+        XMStoreFloat3(&sine, sines);
+        XMStoreFloat3(&cosine, cosines);
+
+        // The rows of RotationX * RotationY * RotationZ, multiplied out.
+        const XMVECTOR rotationRow0 = XMVectorSet(cosine.y * cosine.z, cosine.y * sine.z, -sine.y, 0.0f);
+        const XMVECTOR rotationRow1 = XMVectorSet(sine.x * sine.y * cosine.z - cosine.x * sine.z, sine.x * sine.y * sine.z + cosine.x * cosine.z, sine.x * cosine.y, 0.0f);
+        const XMVECTOR rotationRow2 = XMVectorSet(cosine.x * sine.y * cosine.z + sine.x * sine.z, cosine.x * sine.y * sine.z - sine.x * cosine.z, cosine.x * cosine.y, 0.0f);
+
+        // Scaling first scales each row, and translating last fills in the bottom row.
+        XMMATRIX localMatrix;
+        localMatrix.r[0] = XMVectorScale(rotationRow0, scale.x);
+        localMatrix.r[1] = XMVectorScale(rotationRow1, scale.y);
+        localMatrix.r[2] = XMVectorScale(rotationRow2, scale.z);
+        localMatrix.r[3] = XMVectorSet(translation.x, translation.y, translation.z, 1.0f);
+
+        return localMatrix;
     }
 
     // ==== Hierarchy ====
@@ -209,11 +234,13 @@ namespace Aurora
         // Update the transform without the parent now.
         UpdateTransform();
 
-        // Make the parent search for children. This is an indirect way of making the parent "forget" about this child as it won't be able to find it.
+        // Make the parent forget about this child.
         if (temporaryParentReference)
         {
-            temporaryParentReference->AcquireChildren();
+            temporaryParentReference->RemoveChildTransform(this);
         }
+
+        InvalidateHierarchy();
     }
 
     // Sets a parent for this transform.
@@ -244,11 +271,14 @@ namespace Aurora
         // If the new parent is a descendent of this transform.
         if (newParent->IsDescendantOf(this))
         {
+            // Our children leave us as we go, hence we iterate over a copy.
+            const std::vector<Transform*> children = m_Children;
+
             // If this transform already has a parent...
             if (this->HasParentTransform())
             {
                 // Assign the parent of this transform to the children.
-                for (const auto& childTransform : m_Children)
+                for (const auto& childTransform : children)
                 {
                     childTransform->SetParentTransform(GetParentTransform());
                 }
@@ -256,7 +286,7 @@ namespace Aurora
             else // If this transform doesn't have a parent...
             {
                 // Make the children orphans.
-                for (const auto& childTransform : m_Children)
+                for (const auto& childTransform : children)
                 {
                     childTransform->BecomeOrphan();
                 }
@@ -268,16 +298,18 @@ namespace Aurora
         m_ParentTransform = newParent;
         if (oldParent)
         {
-            oldParent->AcquireChildren(); // Update the old parent (so it removes this child).
+            oldParent->RemoveChildTransform(this); // Update the old parent (so it removes this child).
         }
 
-        // Make the new parent "aware" of this transform/child.
+        // Make the new parent "aware" of this transform/child. Children are linked directly rather than by having the parent search the entire world for them (AcquireChildren),
+        // which made building a hierarchy quadratic in the world's entity count.
         if (m_ParentTransform)
         {
-            m_ParentTransform->AcquireChildren();
+            m_ParentTransform->m_Children.emplace_back(this);
         }
 
         UpdateTransform();
+        InvalidateHierarchy();
     }
 
     void Transform::AddChildTransform(Transform* childTransform)
@@ -295,6 +327,15 @@ namespace Aurora
         childTransform->SetParentTransform(this);
     }
 
+    void Transform::RemoveChildTransform(Transform* childTransform)
+    {
+        auto child = std::find(m_Children.begin(), m_Children.end(), childTransform);
+        if (child != m_Children.end())
+        {
+            m_Children.erase(child);
+        }
+    }
+
     // Returns a child with the given index.
     Transform* Transform::GetChildByIndex(uint32_t childIndex)
     {
@@ -357,6 +398,8 @@ namespace Aurora
                 possibleChild->AcquireChildren();
             }
         }
+
+        InvalidateHierarchy();
     }
 
     bool Transform::IsDescendantOf(const Transform* transform) const
@@ -399,4 +442,23 @@ namespace Aurora
         XMMATRIX worldMatrix = HasParentTransform() ? GetParentTransform()->GetWorldMatrix() : g_IdentityMatrix;
         return worldMatrix;
     }
+
+    void Transform::StoreWorldMatrix(FXMMATRIX worldMatrix)
+    {
+        XMStoreFloat4x4(&m_WorldMatrix, worldMatrix);
+
+        XMVECTOR scaleWorld, rotationWorld, positionWorld;
+        XMMatrixDecompose(&scaleWorld, &rotationWorld, &positionWorld, worldMatrix);
+        XMStoreFloat3(&m_ScaleWorld, scaleWorld);
+        XMStoreFloat4(&m_RotationWorld, rotationWorld);
+        XMStoreFloat3(&m_PositionWorld, positionWorld);
+    }
+
+    void Transform::InvalidateHierarchy()
+    {
+        if (World* world = m_EngineContext->GetSubsystem<World>())
+        {
+            world->InvalidateTransformHierarchy(GetEntity());
+        }
+    }
 }
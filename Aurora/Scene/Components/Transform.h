@@ -1,6 +1,7 @@
 #pragma once
 #include "IComponent.h"
 #include <DirectXMath.h>
+#include <algorithm>
 #include <vector>
 
 using namespace DirectX;
@@ -8,6 +9,8 @@ static const XMFLOAT4X4 IdentityMatrix = XMFLOAT4X4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0
 
 namespace Aurora
 {
+    class TransformHierarchy;
+
     enum Transform_Flags
     {
         Transform_Flag_Empty = 0,
@@ -27,7 +30,7 @@ namespace Aurora
 
         void UpdateTransform();
 
-        void SetDirty(bool value = true) { if (value) { m_Flags |= Transform_Flags::Transform_Flag_Dirty; } else { m_Flags &= ~Transform_Flags::Transform_Flag_Dirty; } }
+        void SetDirty(bool value = true); // Becoming dirty queues us with our world's hierarchy, so that only changed subtrees are updated.
         bool IsDirty() const { return m_Flags & Transform_Flags::Transform_Flag_Dirty; }
 
         // Setters
@@ -46,6 +49,10 @@ namespace Aurora
         XMVECTOR GetScaleVector() const;
         XMMATRIX GetLocalMatrix() const;    // Computes the local space matrix from scale, rotation and translation.
 
+        // Scale, then rotation about X, Y and Z in turn, then translation. Equivalent to multiplying out each of those matrices, with all three angles taken through a single
+        // sine/cosine evaluation.
+        static XMMATRIX ComposeLocalMatrix(const XMFLOAT3& scale, const XMFLOAT3& rotationInRadians, const XMFLOAT3& translation);
+
         // ==== Hierarchy ====
         void BecomeOrphan();
 
@@ -63,14 +70,23 @@ namespace Aurora
         Transform* GetChildByName(const std::string& childName);
         const std::vector<Transform*>& GetChildren() const { return m_Children; }
 
+        // Forgets every child for which predicate(child) holds in a single pass, keeping the order of the rest. Their parent references are left untouched.
+        template<typename Predicate>
+        void RemoveChildTransforms(Predicate&& predicate) { m_Children.erase(std::remove_if(m_Children.begin(), m_Children.end(), predicate), m_Children.end()); }
+
         void AcquireChildren();
         bool IsDescendantOf(const Transform* transform) const;
         void GetDescendants(std::vector<Transform*>* descendants);
         
-        const XMMATRIX& GetWorldMatrix() const { return XMLoadFloat4x4(&m_WorldMatrix); }
+        XMMATRIX GetWorldMatrix() const { return XMLoadFloat4x4(&m_WorldMatrix); }
 
     private:
+        friend class TransformHierarchy;
+
         XMMATRIX GetParentTransformMatrix() const;
+        void StoreWorldMatrix(FXMMATRIX worldMatrix); // Also refreshes our cached world position, rotation and scale.
+        void InvalidateHierarchy(); // Lets our world know the shape of the hierarchy has changed. See TransformHierarchy.h.
+        void RemoveChildTransform(Transform* childTransform); // Keeps the order of our remaining children.
 
     public:
         //Hierarchy
@@ -87,6 +103,16 @@ namespace Aurora
         XMFLOAT4X4 m_WorldMatrix = IdentityMatrix; // World, relative to its parents.
         XMFLOAT4X4 m_LocalMatrix = IdentityMatrix; // Local.
 
+        // The world matrix decomposed, once per update rather than upon every query.
+        XMFLOAT3 m_PositionWorld = XMFLOAT3(0.0f, 0.0f, 0.0f);
+        XMFLOAT4 m_RotationWorld = XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f); // Quaternion
+        XMFLOAT3 m_ScaleWorld = XMFLOAT3(1.0f, 1.0f, 1.0f);
+
         uint32_t m_Flags = Transform_Flags::Transform_Flag_Dirty;
+
+    private:
+        // Our place within our world's TransformHierarchy, assigned whenever it is rebuilt.
+        TransformHierarchy* m_Hierarchy = nullptr;
+        uint32_t m_HierarchyIndex = ~0u;
     };
 }
\ No newline at end of file
@@ -13,14 +13,17 @@
 
 namespace Aurora
 {
-    Entity::Entity(EngineContext* engineContext)
+    Entity::Entity(EngineContext* engineContext, EntityHandle entityHandle)
     {
         m_EngineContext = engineContext;
+        m_EntityHandle = entityHandle;
         SetEntityName("Entity");
         m_IsActive = true;
 
-        m_Transform = AddComponent<Transform>();
         m_WorldContext = m_EngineContext->GetSubsystem<World>();
+        m_ComponentRegistry = &m_WorldContext->GetComponentRegistry();
+        m_Components.reserve(static_cast<uint32_t>(ComponentType::Unknown)); // One of each type at most, so this is the only allocation our list makes.
+        m_Transform = AddComponent<Transform>();
     }
 
     Entity::~Entity()
@@ -30,23 +33,77 @@ namespace Aurora
         m_Transform = nullptr;
         m_EngineContext = nullptr;
 
+        if (m_WorldContext)
+        {
+            DetachFromWorld();
+        }
+
         m_ObjectName.clear();
-        m_ComponentMask = 0;
-        
-        for (auto it = m_Components.begin(); it != m_Components.end();)
+    }
+
+    void Entity::DetachFromWorld()
+    {
+        if (!m_WorldContext)
+        {
+            return;
+        }
+
+        for (IComponent* component : m_Components)
+        {
+            component->Remove();
+        }
+
+        // Destroy in reverse order of addition, as later components may depend on earlier ones (such as colliders on rigid bodies).
+        for (auto it = m_Components.rbegin(); it != m_Components.rend(); ++it)
         {
-            (*it)->Remove();
-            (*it).reset();
-            it = m_Components.erase(it);
+            m_ComponentRegistry->GetStorage((*it)->GetType())->Remove(m_EntityHandle.m_Index);
         }
 
         m_Components.clear();
+        m_ComponentMask = 0;
+        m_Transform = nullptr;
+
+        // Our slot may now be reused, with any handles to us becoming stale.
+        m_WorldContext->ReleaseEntityHandle(m_EntityHandle);
+        m_WorldContext = nullptr;
+        m_ComponentRegistry = nullptr;
+    }
+
+    void Entity::SetEntityName(const std::string& name)
+    {
+        if (m_WorldContext)
+        {
+            m_WorldContext->ReindexEntityName(this, name);
+        }
+
+        m_ObjectName = name;
+    }
+
+    void Entity::SetObjectID(uint32_t newID)
+    {
+        if (m_WorldContext)
+        {
+            m_WorldContext->ReindexEntityID(this, newID);
+        }
+
+        m_ObjectID = newID;
+    }
+
+    void Entity::SetComponentMask(uint32_t componentMask)
+    {
+        const uint32_t previousComponentMask = m_ComponentMask;
+        m_ComponentMask = componentMask;
+
+        if (m_WorldContext && previousComponentMask != componentMask)
+        {
+            m_WorldContext->UpdateEntityQueries(this, previousComponentMask);
+        }
     }
 
     void Entity::Start()
     {
         // Call component OnStart() across all of the engine's components.
-        for (const std::shared_ptr<IComponent>& component : m_Components)
+        for (IComponent* component : m_Components)
         {
             if (component)
             {
@@ -58,7 +115,7 @@ namespace Aurora
     void Entity::Stop()
     {
         // Call component Stop() across all of the engine's components.
-        for (const std::shared_ptr<IComponent>& component : m_Components)
+        for (IComponent* component : m_Components)
         {
             if (component)
             {
@@ -74,10 +131,10 @@ namespace Aurora
             return;
         }
 
-        // Call component Update() across all of the engine's components.
-        for (const std::shared_ptr<IComponent>& component : m_Components)
+        // Call component Update() across all of the engine's components. The World no longer calls this, ticking each component type in its own pass instead.
+        for (IComponent* component : m_Components)
         {
-            if (component)
+            if (component && component != m_Transform)
             {
                 component->Tick(deltaTime);
             }
@@ -97,13 +154,13 @@ namespace Aurora
         // Components
         {
             binarySerializer->Write(static_cast<uint32_t>(m_Components.size()));
-            for (const std::shared_ptr<IComponent>& component : m_Components)
+            for (IComponent* component : m_Components)
             {
                 binarySerializer->Write(static_cast<uint32_t>(component->GetType()));
                 binarySerializer->Write(component->GetObjectID());
             }
 
-            for (const std::shared_ptr<IComponent>& component : m_Components)
+            for (IComponent* component : m_Components)
             {
                 component->Serialize(binarySerializer);
             }
@@ -144,7 +201,7 @@ namespace Aurora
         {
             binaryDeserializer->Read(&m_IsActive);
             binaryDeserializer->Read(&m_IsVisibleInHierarchy);
-            binaryDeserializer->Read(&m_ObjectID);
+            SetObjectID(binaryDeserializer->ReadAs<uint32_t>());
             SetEntityName(binaryDeserializer->ReadAs<std::string>());
         }
 
@@ -163,7 +220,7 @@ namespace Aurora
             }
 
             // Sometimes, there are component dependencies, such as a collider that needs to set its shape for a rigidbody. Hence, its important to create the components first, and then deserialize them.
-            for (const auto& component : m_Components)
+            for (IComponent* component : m_Components)
             {
                 component->Deserialize(binaryDeserializer);
             }
@@ -191,16 +248,11 @@ namespace Aurora
                 childEntities.emplace_back(child);
             }
 
-            // Children
+            // Children. Each links itself to us as its transform is deserialized, so there is no need to search the world for them afterwards.
             for (const auto& child : childEntities)
             {
                 child.lock()->Deserialize(binaryDeserializer, GetTransform());
             }
-
-            if (m_Transform)
-            {
-                m_Transform->AcquireChildren();
-            }
         }
 
         scene->SetSceneDirty();
@@ -221,9 +273,9 @@ namespace Aurora
             clonedEntity->SetHierarchyVisibility(entity->IsVisibleInHierarchy());
 
             // Clone all of its components.
-            for (const std::shared_ptr<IComponent>& component : entity->GetAllComponents())
+            for (IComponent* component : entity->GetAllComponents())
             {
-                const std::shared_ptr<IComponent>& originalComponent = component;
+                const IComponent* originalComponent = component;
                 IComponent* clonedComponent = clonedEntity->AddComponent(component->GetType());
                 clonedComponent->SetComponentAttributes(originalComponent->GetComponentAttributes());
             }
@@ -278,13 +330,14 @@ namespace Aurora
 
         for (auto it = m_Components.begin(); it != m_Components.end();)
         {
-            std::shared_ptr<IComponent> component = *it;
+            IComponent* component = *it;
             
             if (componentID == component->GetObjectID())
             {
                 componentType = component->GetType();
                 component->Remove();
                 it = m_Components.erase(it);
+                m_ComponentRegistry->GetStorage(componentType)->Remove(m_EntityHandle.m_Index);
                 break;
             }
             else
@@ -295,9 +348,9 @@ namespace Aurora
 
         bool othersOfSameTypeExist = false;
         /// ScriptInstance component stuff in the future.
-        if (!othersOfSameTypeExist)
+        if (!othersOfSameTypeExist && componentType != ComponentType::Unknown)
         {
-            m_ComponentMask &= ~GetComponentMask(componentType);
+            SetComponentMask(m_ComponentMask & ~GetComponentMask(componentType));
         }
         /// Resolve scene.
     }  
@@ -2,6 +2,7 @@
 #include <vector>
 #include "../Resource/AuroraObject.h"
 #include "Components/IComponent.h"
+#include "ComponentStorage.h"
 #include <DirectXPackedVector.h>
 #include "Components/Transform.h"
 
@@ -14,7 +15,7 @@ namespace Aurora
     class Entity : public AuroraObject, public std::enable_shared_from_this<Entity>
     {
     public:
-        Entity(EngineContext* engineContext);
+        Entity(EngineContext* engineContext, EntityHandle entityHandle);
         ~Entity();
 
         void Start();
@@ -28,7 +29,8 @@ namespace Aurora
 
         // Properties
         const std::string& GetEntityName() const { return m_ObjectName; }
-        void SetEntityName(const std::string& name) { m_ObjectName = name; }
+        void SetEntityName(const std::string& name);
+        void SetObjectID(uint32_t newID); // Hides AuroraObject's, so our world's ID lookup stays in sync. Entity IDs should thus never be set through an AuroraObject pointer.
 
         bool IsActive() const { return m_IsActive; }
         void SetActive(const bool isActive) { m_IsActive = isActive; }
@@ -45,12 +47,12 @@ namespace Aurora
                 return GetComponent<T>();
             }
 
-            // Create a new component.
-            std::shared_ptr<T> newComponent = std::make_shared<T>(m_EngineContext, this, componentID);
+            // Create a new component within our world's storage of its type.
+            T* newComponent = m_ComponentRegistry->GetStorage<T>().Emplace(m_EntityHandle.m_Index, m_EngineContext, this, componentID);
             
             // Save new component.
-            m_Components.emplace_back(std::static_pointer_cast<IComponent>(newComponent));
-            m_ComponentMask |= GetComponentMask(type);
+            m_Components.emplace_back(newComponent);
+            SetComponentMask(m_ComponentMask | GetComponentMask(type));
 
             // Initialize component.
             newComponent->SetType(type);
@@ -58,7 +60,7 @@ namespace Aurora
 
             /// Make the scene resolve.
 
-            return newComponent.get();
+            return newComponent;
         }
 
         IComponent* AddComponent(ComponentType componentType, uint32_t componentID = 0);
@@ -74,15 +76,7 @@ namespace Aurora
                 return nullptr;
             }
 
-            for (const std::shared_ptr<IComponent>& component : m_Components)
-            {
-                if (component->GetType() == type)
-                {
-                    return static_cast<T*>(component.get());
-                }
-            }
-
-            return nullptr;
+            return m_ComponentRegistry->GetStorage<T>().Get(m_EntityHandle.m_Index);
         }
 
         // Returns components of type T if they exist.
@@ -97,14 +91,14 @@ namespace Aurora
                 return components;
             }
 
-            for (const std::shared_ptr<IComponent>& component : m_Components)
+            for (IComponent* component : m_Components)
             {
                 if (component->GetType() != type)
                 {
                     continue;
                 }
 
-                components.emplace_back(static_cast<T*>(component.get()));
+                components.emplace_back(static_cast<T*>(component));
             }
 
             return components;
@@ -140,6 +134,9 @@ namespace Aurora
         template <typename T>
         bool HasComponent() { return HasComponent(IComponent::TypeToEnum<T>()); }
 
+        uint32_t GetComponentMask() const { return m_ComponentMask; }
+        static constexpr uint32_t GetComponentMask(ComponentType componentType) { return static_cast<uint32_t>(1) << static_cast<uint32_t>(componentType); }
+
         // Removes a component if it exists.
         template <typename T>
         void RemoveComponent()
@@ -148,12 +145,13 @@ namespace Aurora
 
             for (auto it = m_Components.begin(); it != m_Components.end();)
             {
-                std::shared_ptr<IComponent> component = *it;
+                IComponent* component = *it;
                 if (component->GetType() == type)
                 {
                     component->Remove();
                     it = m_Components.erase(it);
-                    m_ComponentMask &= ~GetComponentMask(type);
+                    SetComponentMask(m_ComponentMask & ~GetComponentMask(type));
+                    m_ComponentRegistry->GetStorage<T>().Remove(m_EntityHandle.m_Index);
                 }
                 else
                 {
@@ -165,7 +163,9 @@ namespace Aurora
         }
 
         void RemoveComponentByID(uint32_t componentID);
-        const std::vector<std::shared_ptr<IComponent>>& GetAllComponents() const { return m_Components; }
+        const std::vector<IComponent*>& GetAllComponents() const { return m_Components; } // In the order they were added.
+        EntityHandle GetEntityHandle() const { return m_EntityHandle; }
+        void DetachFromWorld(); // Destroys our components and forgets our world. Used by the world upon removing us and upon its own destruction, as outside references may keep us alive for longer.
 
         void MarkForDestruction() { m_IsDestructionPending = true; }
         bool IsPendingDestruction() const { return m_IsDestructionPending; }
@@ -182,16 +182,18 @@ namespace Aurora
         bool m_IsActive = true;
 
     private:
-        constexpr uint32_t GetComponentMask(ComponentType componentType) { return static_cast<uint32_t>(1) << static_cast<uint32_t>(componentType); }
+        void SetComponentMask(uint32_t componentMask); // Keeps our world's entity queries in sync.
         
     private:
         bool m_IsVisibleInHierarchy = true;
         bool m_IsDestructionPending = false;
 
-        // Components
-        std::vector<std::shared_ptr<IComponent>> m_Components;
+        // Components. Owned by our world's component storages - see ComponentStorage.h.
+        std::vector<IComponent*> m_Components;
         uint32_t m_ComponentMask = 0;
 
         World* m_WorldContext = nullptr;
+        ComponentRegistry* m_ComponentRegistry = nullptr;
+        EntityHandle m_EntityHandle;
     };
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* == Entity Queries ==
+
+    A persistent list of every entity in the World whose components include a given set, such as "every entity with a Light" or "every entity with a Renderable and a
+    RigidBody". Queries are created through World::GetEntityQuery and live as long as the World, which updates them as entities are added and removed, and as components are
+    added to or removed from entities. Subsystems thus grab their query once and read a contiguous list every frame, rather than filtering every entity in the world.
+
+    Membership is tracked by entity slot index (see EntityHandle), and removal swaps the last entity into the hole. The order of entities within a query is hence unspecified.
+    Inactive entities remain within queries - check Entity::IsActive() where it matters.
+*/
+
+namespace Aurora
+{
+    class Entity;
+
+    class EntityQuery
+    {
+    public:
+        EntityQuery(uint32_t componentMask) : m_ComponentMask(componentMask) { }
+
+        uint32_t GetComponentMask() const { return m_ComponentMask; }
+        bool Matches(uint32_t entityComponentMask) const { return (entityComponentMask & m_ComponentMask) == m_ComponentMask; }
+
+        const std::vector<Entity*>& GetEntities() const { return m_Entities; }
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_Entities.size()); }
+
+    private:
+        friend class World;
+
+        bool Contains(uint32_t slotIndex) const { return slotIndex < m_Positions.size() && m_Positions[slotIndex] != m_InvalidPosition; }
+
+        void Insert(Entity* entity, uint32_t slotIndex)
+        {
+            if (Contains(slotIndex))
+            {
+                return;
+            }
+
+            if (slotIndex >= m_Positions.size())
+            {
+                m_Positions.resize(static_cast<size_t>(slotIndex) + 1, m_InvalidPosition);
+            }
+
+            m_Positions[slotIndex] = static_cast<uint32_t>(m_Entities.size());
+            m_Entities.push_back(entity);
+            m_SlotIndices.push_back(slotIndex);
+        }
+
+        void Erase(uint32_t slotIndex)
+        {
+            if (!Contains(slotIndex))
+            {
+                return;
+            }
+
+            const uint32_t position = m_Positions[slotIndex];
+            m_Entities[position] = m_Entities.back();
+            m_SlotIndices[position] = m_SlotIndices.back();
+            m_Positions[m_SlotIndices[position]] = position;
+
+            m_Entities.pop_back();
+            m_SlotIndices.pop_back();
+            m_Positions[slotIndex] = m_InvalidPosition;
+        }
+
+    private:
+        static constexpr uint32_t m_InvalidPosition = ~0u;
+
+        uint32_t m_ComponentMask = 0;
+        std::vector<Entity*> m_Entities;
+        std::vector<uint32_t> m_SlotIndices; // Parallel to m_Entities.
+        std::vector<uint32_t> m_Positions;   // Entity slot index to position within m_Entities.
+    };
+}
@@ -0,0 +1,59 @@
+#include "Aurora.h"
+#include "PrefabTemplate.h"
+#include "Entity.h"
+
+namespace Aurora
+{
+    void PrefabTemplate::Capture(const std::vector<Entity*>& rootEntities)
+    {
+        Clear();
+
+        for (Entity* rootEntity : rootEntities)
+        {
+            Append(rootEntity);
+        }
+    }
+
+    void PrefabTemplate::Append(Entity* rootEntity)
+    {
+        if (rootEntity)
+        {
+            CaptureEntity(rootEntity, m_InvalidIndex);
+            m_RootCount++;
+        }
+    }
+
+    void PrefabTemplate::Clear()
+    {
+        m_Entities.clear();
+        m_Components.clear();
+        m_RootCount = 0;
+    }
+
+    void PrefabTemplate::CaptureEntity(Entity* entity, uint32_t parentIndex)
+    {
+        const uint32_t entityIndex = static_cast<uint32_t>(m_Entities.size());
+
+        PrefabTemplateEntity& templateEntity = m_Entities.emplace_back();
+        templateEntity.m_Name = entity->GetEntityName();
+        templateEntity.m_IsActive = entity->IsActive();
+        templateEntity.m_IsVisibleInHierarchy = entity->IsVisibleInHierarchy();
+        templateEntity.m_ParentIndex = parentIndex;
+        templateEntity.m_ChildCount = entity->GetTransform()->GetChildrenCount();
+        templateEntity.m_ComponentOffset = static_cast<uint32_t>(m_Components.size());
+        templateEntity.m_ComponentCount = static_cast<uint32_t>(entity->GetAllComponents().size());
+
+        for (IComponent* component : entity->GetAllComponents())
+        {
+            PrefabTemplateComponent& templateComponent = m_Components.emplace_back();
+            templateComponent.m_Type = component->GetType();
+            templateComponent.m_AttributeValues = component->GetAttributeValues();
+        }
+
+        // Depth first, hence every child follows its parent. Note that our reference into m_Entities is invalidated from here on.
+        for (Transform* childTransform : entity->GetTransform()->GetChildren())
+        {
+            CaptureEntity(childTransform->GetEntity(), entityIndex);
+        }
+    }
+}
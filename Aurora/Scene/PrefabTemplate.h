@@ -0,0 +1,74 @@
+#pragma once
+#include <any>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <DirectXMath.h>
+#include "Components/IComponent.h"
+
+/* == Prefab Templates ==
+
+    An in-memory snapshot of one or more entity hierarchies, from which any number of instances can be created without going back to disk or re-decoding a file. Each
+    entity is captured alongside its components' attribute values, decoded once upon capture, and the index of its parent within the template. Entities are stored parent
+    first, so instancing a template is a single forward pass: create every entity, apply its attribute values, and link it to its already created parent.
+
+    Templates are captured from live entities (see Capture()). A Prefab resource captures one as it is created or loaded, which World::Instantiate then stamps out in bulk.
+    Captured values may refer to shared resources (such as a renderable's model), which instances share just as cloned entities do.
+*/
+
+namespace Aurora
+{
+    class Entity;
+
+    // Overrides the local transform of each instance's roots.
+    struct PrefabInstanceTransform
+    {
+        DirectX::XMFLOAT3 m_Position = DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f);
+        DirectX::XMFLOAT3 m_RotationInRadians = DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f);
+        DirectX::XMFLOAT3 m_Scale = DirectX::XMFLOAT3(1.0f, 1.0f, 1.0f);
+    };
+
+    struct PrefabTemplateComponent
+    {
+        ComponentType m_Type = ComponentType::Unknown;
+        std::vector<std::any> m_AttributeValues; // See IComponent::GetAttributeValues.
+    };
+
+    struct PrefabTemplateEntity
+    {
+        std::string m_Name;
+        bool m_IsActive = true;
+        bool m_IsVisibleInHierarchy = true;
+
+        uint32_t m_ParentIndex = ~0u;   // Within the template, always ahead of us. ~0u for roots.
+        uint32_t m_ChildCount = 0;
+        uint32_t m_ComponentOffset = 0; // Our components span [m_ComponentOffset, m_ComponentOffset + m_ComponentCount) of the template's components.
+        uint32_t m_ComponentCount = 0;
+    };
+
+    class PrefabTemplate
+    {
+    public:
+        static constexpr uint32_t m_InvalidIndex = ~0u;
+
+        // Replaces our contents with the given roots and all of their descendants.
+        void Capture(const std::vector<Entity*>& rootEntities);
+        void Append(Entity* rootEntity); // Captures another root and its descendants after those we hold, leaving them untouched.
+        void Clear();
+
+        bool IsEmpty() const { return m_Entities.empty(); }
+        uint32_t GetEntityCount() const { return static_cast<uint32_t>(m_Entities.size()); }
+        uint32_t GetRootCount() const { return m_RootCount; }
+
+        const std::vector<PrefabTemplateEntity>& GetEntities() const { return m_Entities; }
+        const std::vector<PrefabTemplateComponent>& GetComponents() const { return m_Components; }
+
+    private:
+        void CaptureEntity(Entity* entity, uint32_t parentIndex);
+
+    private:
+        std::vector<PrefabTemplateEntity> m_Entities;       // Parents ahead of their children.
+        std::vector<PrefabTemplateComponent> m_Components;  // Grouped by entity, in the order of their entities.
+        uint32_t m_RootCount = 0;
+    };
+}
@@ -0,0 +1,205 @@
+#include "Aurora.h"
+#include "SceneGenerator.h"
+#include "World.h"
+#include "Components/Renderable.h"
+#include "Components/Light.h"
+#include "Components/RigidBody.h"
+#include "Components/Script.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Aurora
+{
+    SceneGenerator::SceneGenerator(World* world, const SceneGeneratorSettings& generatorSettings) : m_RandomEngine(generatorSettings.m_Seed)
+    {
+        m_World = world;
+        m_Settings = generatorSettings;
+        m_Settings.m_HierarchyDepth = std::max(m_Settings.m_HierarchyDepth, 1u);
+        m_NextEntityID = m_Settings.m_FirstEntityID;
+
+        // Every level holds as many entities as the one above it times our branching, up to the entity count.
+        uint32_t levelSize = 1;
+        m_EntitiesPerHierarchy = 1;
+        for (uint32_t level = 1; level < m_Settings.m_HierarchyDepth && m_EntitiesPerHierarchy < m_Settings.m_EntityCount; level++)
+        {
+            levelSize *= m_Settings.m_ChildrenPerEntity;
+            m_EntitiesPerHierarchy += levelSize;
+        }
+        m_EntitiesPerHierarchy = std::max(std::min(m_EntitiesPerHierarchy, m_Settings.m_EntityCount), 1u);
+
+        const uint32_t hierarchyCount = (m_Settings.m_EntityCount + m_EntitiesPerHierarchy - 1) / m_EntitiesPerHierarchy;
+        m_SceneExtent = m_Settings.m_RootSpacing * std::sqrt(static_cast<float>(hierarchyCount));
+    }
+
+    void SceneGenerator::Generate()
+    {
+        const uint32_t hierarchyCount = (m_Settings.m_EntityCount + m_EntitiesPerHierarchy - 1) / m_EntitiesPerHierarchy;
+        m_RootHandles.reserve(m_RootHandles.size() + hierarchyCount);
+        m_HierarchySizes.reserve(m_HierarchySizes.size() + hierarchyCount);
+
+        for (uint32_t entitiesLeft = m_Settings.m_EntityCount; entitiesLeft > 0;)
+        {
+            const uint32_t hierarchySize = std::min(entitiesLeft, m_EntitiesPerHierarchy);
+            m_RootHandles.push_back(GenerateHierarchy(hierarchySize));
+            m_HierarchySizes.push_back(hierarchySize);
+            entitiesLeft -= hierarchySize;
+        }
+    }
+
+    void SceneGenerator::MoveRoots()
+    {
+        if (m_RootHandles.empty())
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<uint32_t> randomHierarchy(0, static_cast<uint32_t>(m_RootHandles.size()) - 1);
+        std::uniform_real_distribution<float> randomOffset(-1.0f, 1.0f);
+
+        const uint32_t moveCount = static_cast<uint32_t>(m_Settings.m_MoveRatio * m_RootHandles.size());
+        for (uint32_t i = 0; i < moveCount; i++)
+        {
+            if (Entity* rootEntity = m_World->GetEntityByHandle(m_RootHandles[randomHierarchy(m_RandomEngine)]))
+            {
+                const XMFLOAT3 position = rootEntity->GetTransform()->GetPosition();
+                rootEntity->GetTransform()->Translate(XMFLOAT3(position.x + randomOffset(m_RandomEngine), position.y, position.z + randomOffset(m_RandomEngine)));
+            }
+        }
+    }
+
+    void SceneGenerator::Churn()
+    {
+        m_ChurnedEntitiesLastCall = 0;
+        if (m_RootHandles.empty() || m_Settings.m_ChurnRatio <= 0.0f)
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<uint32_t> randomHierarchy(0, static_cast<uint32_t>(m_RootHandles.size()) - 1);
+
+        const float churnedEntityCount = m_Settings.m_ChurnRatio * m_Settings.m_EntityCount;
+        const uint32_t churnCount = std::max(static_cast<uint32_t>(std::lround(churnedEntityCount / m_EntitiesPerHierarchy)), 1u);
+        for (uint32_t i = 0; i < churnCount; i++)
+        {
+            // Removed hierarchies are only destroyed once the World resolves its batch, hence may be picked twice. Their replacement stands in either way.
+            const uint32_t hierarchyIndex = randomHierarchy(m_RandomEngine);
+            if (Entity* rootEntity = m_World->GetEntityByHandle(m_RootHandles[hierarchyIndex]))
+            {
+                m_World->EntityRemove(rootEntity->GetPointerShared());
+            }
+
+            m_RootHandles[hierarchyIndex] = GenerateHierarchy(m_HierarchySizes[hierarchyIndex]);
+            m_ChurnedEntitiesLastCall += m_HierarchySizes[hierarchyIndex];
+        }
+    }
+
+    void SceneGenerator::Remove()
+    {
+        for (EntityHandle rootHandle : m_RootHandles)
+        {
+            if (Entity* rootEntity = m_World->GetEntityByHandle(rootHandle))
+            {
+                m_World->EntityRemove(rootEntity->GetPointerShared());
+            }
+        }
+
+        m_RootHandles.clear();
+        m_HierarchySizes.clear();
+    }
+
+    std::vector<std::shared_ptr<Entity>> SceneGenerator::GetRootEntities() const
+    {
+        std::vector<std::shared_ptr<Entity>> rootEntities;
+        rootEntities.reserve(m_RootHandles.size());
+
+        for (EntityHandle rootHandle : m_RootHandles)
+        {
+            if (Entity* rootEntity = m_World->GetEntityByHandle(rootHandle))
+            {
+                rootEntities.push_back(rootEntity->GetPointerShared());
+            }
+        }
+
+        return rootEntities;
+    }
+
+    EntityHandle SceneGenerator::GenerateHierarchy(uint32_t entityCount)
+    {
+        Entity* rootEntity = CreateEntity(nullptr, GetRandomRootPosition());
+        uint32_t createdCount = 1;
+
+        // Level by level, so that a hierarchy cut short is missing its deepest entities rather than whole branches.
+        std::vector<Transform*> parentLevel = { rootEntity->GetTransform() };
+        std::vector<Transform*> childLevel;
+        for (uint32_t level = 1; level < m_Settings.m_HierarchyDepth && createdCount < entityCount; level++)
+        {
+            childLevel.clear();
+            for (Transform* parentTransform : parentLevel)
+            {
+                for (uint32_t childIndex = 0; childIndex < m_Settings.m_ChildrenPerEntity && createdCount < entityCount; childIndex++)
+                {
+                    const float childOffset = static_cast<float>(childIndex) - 0.5f * static_cast<float>(m_Settings.m_ChildrenPerEntity - 1);
+                    childLevel.push_back(CreateEntity(parentTransform, XMFLOAT3(childOffset, 1.0f, 0.0f))->GetTransform());
+                    createdCount++;
+                }
+            }
+
+            std::swap(parentLevel, childLevel);
+        }
+
+        return rootEntity->GetEntityHandle();
+    }
+
+    Entity* SceneGenerator::CreateEntity(Transform* parentTransform, const XMFLOAT3& localPosition)
+    {
+        std::shared_ptr<Entity> entity = m_World->EntityCreate();
+        entity->SetObjectID(m_NextEntityID++);
+        entity->SetEntityName(parentTransform ? "Generated_Child" : "Generated_Root");
+        entity->GetTransform()->Translate(localPosition);
+        if (parentTransform)
+        {
+            entity->GetTransform()->SetParentTransform(parentTransform);
+        }
+
+        AddComponents(entity.get());
+        return entity.get();
+    }
+
+    void SceneGenerator::AddComponents(Entity* entity)
+    {
+        // Drawn in a fixed order, so that the same seed always hands out the same components.
+        const bool hasRenderable = m_RandomRatio(m_RandomEngine) < m_Settings.m_RenderableRatio;
+        const bool hasLight = m_RandomRatio(m_RandomEngine) < m_Settings.m_LightRatio;
+        const bool hasRigidBody = m_RandomRatio(m_RandomEngine) < m_Settings.m_RigidBodyRatio;
+        const bool hasScript = m_RandomRatio(m_RandomEngine) < m_Settings.m_ScriptRatio;
+
+        if (hasRenderable)
+        {
+            entity->AddComponent<Renderable>();
+        }
+
+        if (hasLight)
+        {
+            entity->AddComponent<Light>();
+        }
+
+        if (hasRigidBody)
+        {
+            entity->AddComponent<RigidBody>();
+        }
+
+        if (hasScript)
+        {
+            entity->AddComponent<Script>();
+        }
+    }
+
+    XMFLOAT3 SceneGenerator::GetRandomRootPosition()
+    {
+        std::uniform_real_distribution<float> randomPosition(-0.5f * m_SceneExtent, 0.5f * m_SceneExtent);
+        const float positionX = randomPosition(m_RandomEngine);
+        const float positionZ = randomPosition(m_RandomEngine);
+
+        return XMFLOAT3(positionX, 0.0f, positionZ);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <DirectXMath.h>
+#include "ComponentStorage.h"
+
+/* == Scene Generator ==
+
+    Procedurally builds large synthetic scenes within the World, so that its CPU paths can be measured at entity counts no hand-made scene reaches. A scene is made of
+    many alike hierarchies, each a root with a fixed number of children per entity down to the given depth. The last hierarchy is cut short should the entity count not
+    divide evenly. Roots are scattered over a square on the XZ plane whose area grows with their count, keeping their density constant, with children placed just above
+    their parents.
+
+    - Component Mix: Every entity has a unique ID and a transform, and is given a renderable, light, rigid body and script each by chance, at the ratios of our settings.
+      Renderables are left without a model, and scripts without a module, so that generation touches neither the disk nor the scripting runtime.
+    - Movement: MoveRoots() moves a share of the roots, dirtying their hierarchies as gameplay would.
+    - Churn: Churn() removes a share of the hierarchies through World::EntityRemove and generates each anew at the same size, holding the entity count steady. Removal is
+      resolved at the end of the World's next tick, as with any other.
+
+    Generation is seeded, hence the same settings build the same scene. Entities are created on the calling thread, which must be the World's.
+*/
+
+namespace Aurora
+{
+    class World;
+    class Entity;
+    class Transform;
+
+    struct SceneGeneratorSettings
+    {
+        uint32_t m_EntityCount = 10000;
+        uint32_t m_HierarchyDepth = 4;     // Levels per hierarchy, its root included. A depth of 1 makes every entity a root.
+        uint32_t m_ChildrenPerEntity = 3;  // Of every entity above the deepest level.
+
+        // Chance of any entity being given each component.
+        float m_RenderableRatio = 0.6f;
+        float m_LightRatio = 0.01f;
+        float m_RigidBodyRatio = 0.05f;
+        float m_ScriptRatio = 0.1f;
+
+        float m_MoveRatio = 0.05f;         // Of roots moved by MoveRoots().
+        float m_ChurnRatio = 0.01f;        // Of entities removed and generated anew by Churn(), rounded to whole hierarchies (at least one should the ratio be above 0).
+        float m_RootSpacing = 8.0f;        // Roots are scattered a single root per square of this size on average.
+        uint32_t m_Seed = 1;
+        uint32_t m_FirstEntityID = 0x80000000; // Generated entities are numbered upwards from here, above anything GenerateObjectID() hands out. Its range is far too
+                                               // small for scenes of this size, and loading resolves parents by ID.
+    };
+
+    class SceneGenerator
+    {
+    public:
+        SceneGenerator(World* world, const SceneGeneratorSettings& generatorSettings);
+
+        void Generate(); // Creates our settings' entity count on top of whatever the World holds.
+        void MoveRoots();
+        void Churn();
+        void Remove();   // Queues every generated hierarchy for destruction.
+
+        std::vector<std::shared_ptr<Entity>> GetRootEntities() const; // Of every hierarchy, in the order generated.
+        uint32_t GetHierarchyCount() const { return static_cast<uint32_t>(m_RootHandles.size()); }
+        uint32_t GetEntitiesPerHierarchy() const { return m_EntitiesPerHierarchy; }
+        const std::vector<uint32_t>& GetHierarchySizes() const { return m_HierarchySizes; } // Entities within each hierarchy, in the order of GetRootEntities().
+        uint32_t GetChurnedEntitiesLastCall() const { return m_ChurnedEntitiesLastCall; }
+        uint32_t GetNextEntityID() const { return m_NextEntityID; } // Past every ID we handed out.
+        const SceneGeneratorSettings& GetSettings() const { return m_Settings; }
+
+    private:
+        EntityHandle GenerateHierarchy(uint32_t entityCount); // Returns its root.
+        Entity* CreateEntity(Transform* parentTransform, const DirectX::XMFLOAT3& localPosition);
+        void AddComponents(Entity* entity);
+        DirectX::XMFLOAT3 GetRandomRootPosition();
+
+    private:
+        World* m_World = nullptr;
+        SceneGeneratorSettings m_Settings;
+        std::mt19937 m_RandomEngine;
+        std::uniform_real_distribution<float> m_RandomRatio{ 0.0f, 1.0f };
+
+        uint32_t m_EntitiesPerHierarchy = 1;
+        float m_SceneExtent = 0.0f;                 // Along either axis, centered on the origin.
+
+        std::vector<EntityHandle> m_RootHandles;    // One per hierarchy. Churned hierarchies are replaced in place.
+        std::vector<uint32_t> m_HierarchySizes;     // Entities within each of the above.
+        uint32_t m_ChurnedEntitiesLastCall = 0;
+        uint32_t m_NextEntityID = 0;
+    };
+}
@@ -0,0 +1,210 @@
+#include "Aurora.h"
+#include "TransformHierarchy.h"
+
+namespace Aurora
+{
+    void TransformHierarchy::Update(const ComponentStorage<Transform>& transformStorage, Threading* threading)
+    {
+        m_LastUpdate = UpdateMode::None;
+
+        if (m_IsStale)
+        {
+            Rebuild(transformStorage);
+        }
+
+        if (m_DirtyIndices.empty())
+        {
+            return;
+        }
+
+        if (m_DirtyIndices.size() * m_LevelUpdateFraction >= m_Transforms.size())
+        {
+            UpdateLevels(threading);
+            m_LastUpdate = UpdateMode::Levels;
+        }
+        else
+        {
+            UpdateSubtrees(threading);
+            m_LastUpdate = UpdateMode::Subtrees;
+        }
+
+        m_DirtyIndices.clear();
+    }
+
+    void TransformHierarchy::Rebuild(const ComponentStorage<Transform>& transformStorage)
+    {
+        m_Transforms.clear();
+        m_ParentIndices.clear();
+        m_LevelOffsets.clear();
+
+        // Transforms whose parent isn't around won't be reached below. They mustn't queue themselves under an index which is about to mean something else.
+        for (Transform* transform : transformStorage.GetComponents())
+        {
+            transform->m_Hierarchy = nullptr;
+
+            if (!transform->HasParentTransform())
+            {
+                m_Transforms.push_back(transform);
+                m_ParentIndices.push_back(m_InvalidIndex);
+            }
+        }
+
+        // Breadth first, a level at a time. The children of each level are appended as the next, with siblings kept together.
+        m_ChildOffsets.clear();
+        m_ChildCounts.clear();
+        m_LevelOffsets.push_back(0);
+        uint32_t levelBegin = 0;
+
+        while (levelBegin < m_Transforms.size())
+        {
+            const uint32_t levelEnd = static_cast<uint32_t>(m_Transforms.size());
+            m_LevelOffsets.push_back(levelEnd);
+
+            for (uint32_t i = levelBegin; i < levelEnd; i++)
+            {
+                const std::vector<Transform*>& children = m_Transforms[i]->GetChildren();
+                m_ChildOffsets.push_back(static_cast<uint32_t>(m_Transforms.size()));
+                m_ChildCounts.push_back(static_cast<uint32_t>(children.size()));
+
+                for (Transform* childTransform : children)
+                {
+                    m_Transforms.push_back(childTransform);
+                    m_ParentIndices.push_back(i);
+                }
+            }
+
+            levelBegin = levelEnd;
+        }
+
+        // Transforms which aren't dirty keep their current world matrix, which their children may build upon. Our previous queue referred to the old order, hence we
+        // queue whatever is dirty anew.
+        m_DirtyIndices.clear();
+        m_WorldMatrices.resize(m_Transforms.size());
+        for (uint32_t i = 0; i < m_Transforms.size(); i++)
+        {
+            Transform* transform = m_Transforms[i];
+            transform->m_Hierarchy = this;
+            transform->m_HierarchyIndex = i;
+
+            XMStoreFloat4x4A(&m_WorldMatrices[i], XMLoadFloat4x4(&transform->m_WorldMatrix));
+            if (transform->IsDirty())
+            {
+                m_DirtyIndices.push_back(i);
+            }
+        }
+
+        m_IsUpdated.assign(m_Transforms.size(), 0);
+        m_IsStale = false;
+    }
+
+    void TransformHierarchy::UpdateLevels(Threading* threading)
+    {
+        auto updateRange = [this](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                const uint32_t parentIndex = m_ParentIndices[i];
+                const bool isParentUpdated = parentIndex != m_InvalidIndex && m_IsUpdated[parentIndex];
+
+                m_IsUpdated[i] = isParentUpdated || m_Transforms[i]->IsDirty();
+                if (m_IsUpdated[i])
+                {
+                    UpdateTransform(i);
+                }
+            }
+        };
+
+        // Each level only reads the world matrices of the one before it, which has completed by the time it starts.
+        for (uint32_t level = 0; level < GetLevelCount(); level++)
+        {
+            const uint32_t levelBegin = m_LevelOffsets[level];
+            const uint32_t levelCount = m_LevelOffsets[level + 1] - levelBegin;
+
+            if (threading)
+            {
+                threading->ParallelForRange(levelCount, [&updateRange, levelBegin](uint32_t begin, uint32_t end)
+                {
+                    updateRange(levelBegin + begin, levelBegin + end);
+                });
+            }
+            else
+            {
+                updateRange(levelBegin, levelBegin + levelCount);
+            }
+        }
+    }
+
+    void TransformHierarchy::UpdateSubtrees(Threading* threading)
+    {
+        // Transforms with a dirty ancestor are covered by its subtree. Hierarchies are shallow, so walking up is cheap.
+        m_SubtreeRoots.clear();
+        for (uint32_t transformIndex : m_DirtyIndices)
+        {
+            if (!m_Transforms[transformIndex]->IsDirty())
+            {
+                continue;
+            }
+
+            bool hasDirtyAncestor = false;
+            for (uint32_t parentIndex = m_ParentIndices[transformIndex]; parentIndex != m_InvalidIndex; parentIndex = m_ParentIndices[parentIndex])
+            {
+                if (m_Transforms[parentIndex]->IsDirty())
+                {
+                    hasDirtyAncestor = true;
+                    break;
+                }
+            }
+
+            if (!hasDirtyAncestor)
+            {
+                m_SubtreeRoots.push_back(transformIndex);
+            }
+        }
+
+        // A transform cleaned and dirtied again since our last update is queued twice. Its subtree mustn't be handed to two jobs.
+        std::sort(m_SubtreeRoots.begin(), m_SubtreeRoots.end());
+        m_SubtreeRoots.erase(std::unique(m_SubtreeRoots.begin(), m_SubtreeRoots.end()), m_SubtreeRoots.end());
+
+        auto updateRange = [this](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                UpdateSubtree(m_SubtreeRoots[i]);
+            }
+        };
+
+        if (threading)
+        {
+            threading->ParallelForRange(static_cast<uint32_t>(m_SubtreeRoots.size()), updateRange);
+        }
+        else
+        {
+            updateRange(0, static_cast<uint32_t>(m_SubtreeRoots.size()));
+        }
+    }
+
+    void TransformHierarchy::UpdateSubtree(uint32_t transformIndex)
+    {
+        UpdateTransform(transformIndex);
+
+        const uint32_t childOffset = m_ChildOffsets[transformIndex];
+        for (uint32_t i = childOffset; i < childOffset + m_ChildCounts[transformIndex]; i++)
+        {
+            UpdateSubtree(i);
+        }
+    }
+
+    void TransformHierarchy::UpdateTransform(uint32_t transformIndex)
+    {
+        Transform* transform = m_Transforms[transformIndex];
+        const uint32_t parentIndex = m_ParentIndices[transformIndex];
+
+        const XMMATRIX localMatrix = Transform::ComposeLocalMatrix(transform->m_ScaleLocal, transform->m_RotationInRadians, transform->m_TranslationLocal);
+        const XMMATRIX worldMatrix = parentIndex == m_InvalidIndex ? localMatrix : localMatrix * XMLoadFloat4x4A(&m_WorldMatrices[parentIndex]);
+
+        XMStoreFloat4x4A(&m_WorldMatrices[transformIndex], worldMatrix);
+        XMStoreFloat4x4(&transform->m_LocalMatrix, localMatrix);
+        transform->StoreWorldMatrix(worldMatrix);
+        transform->SetDirty(false);
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "ComponentStorage.h"
+#include "Components/Transform.h"
+#include "../Threading/Spinlock.h"
+
+/* == Transform Hierarchy ==
+
+    Updating world matrices by recursing from every dirty transform into its children chases pointers across the whole hierarchy, and can't be split across threads as
+    a subtree may be reached from several dirty ancestors. The World instead keeps its transforms flattened into depth order: every root, then every child of a root,
+    then every grandchild and so on. Parents thus always sit ahead of their children, each depth forms a contiguous level, and the children of a transform sit next to
+    one another.
+
+    Alongside each transform we keep the index of its parent within the same order, the range of its children, and a copy of its world matrix. Transforms becoming dirty
+    queue their index with us (see Transform::SetDirty), and an update only visits what was queued:
+
+    - Few Changes: Of the queued transforms, those without a dirty ancestor head the subtrees to recompute. These are disjoint, and are split across jobs, each walking
+      its subtrees through our child ranges. A scene that is mostly static thus pays for its moving transforms alone, and nothing at all when nothing moved.
+    - Many Changes (such as after loading): Levels are updated one after the other, with the transforms of a level split across jobs. A transform is recomputed when it is
+      dirty or its parent was recomputed before it. Every pass is a forward stream over our arrays.
+
+    Either way, a transform reads its parent's world matrix from our packed array rather than through the parent itself.
+
+    Local translation, rotation and scale remain owned by the Transform components, as gameplay code and the editor's attributes write to them directly. The order is
+    rebuilt from the World's transform storage whenever the hierarchy changes shape (see Invalidate()), which costs a single pass over every transform.
+*/
+
+namespace Aurora
+{
+    class Threading;
+
+    class TransformHierarchy
+    {
+    public:
+        // Called whenever transforms are created, destroyed or reparented. The order is rebuilt upon our next update.
+        void Invalidate() { m_IsStale = true; }
+        bool IsStale() const { return m_IsStale; }
+
+        // Queues the transform at the given index for our next update. May be called from any thread, though not while we are updating.
+        void MarkDirty(uint32_t transformIndex)
+        {
+            m_DirtyLock.Lock();
+            m_DirtyIndices.push_back(transformIndex);
+            m_DirtyLock.Unlock();
+        }
+
+        // Recomputes the world matrix of every dirty transform and its descendants. Runs on the calling thread if no threading is given.
+        void Update(const ComponentStorage<Transform>& transformStorage, Threading* threading);
+
+        // Invokes callback(transform) for every transform recomputed by our last update, such as to refit bounds which follow them. Nothing is visited if that update
+        // found nothing dirty.
+        template<typename Callback>
+        void ForEachUpdatedTransform(Callback&& callback) const
+        {
+            if (m_LastUpdate == UpdateMode::Levels)
+            {
+                for (uint32_t i = 0; i < m_Transforms.size(); i++)
+                {
+                    if (m_IsUpdated[i])
+                    {
+                        callback(m_Transforms[i]);
+                    }
+                }
+            }
+            else if (m_LastUpdate == UpdateMode::Subtrees)
+            {
+                for (uint32_t subtreeRoot : m_SubtreeRoots)
+                {
+                    ForEachInSubtree(subtreeRoot, callback);
+                }
+            }
+        }
+
+        uint32_t GetTransformCount() const { return static_cast<uint32_t>(m_Transforms.size()); }
+        uint32_t GetLevelCount() const { return m_LevelOffsets.empty() ? 0 : static_cast<uint32_t>(m_LevelOffsets.size() - 1); }
+
+    private:
+        void Rebuild(const ComponentStorage<Transform>& transformStorage);
+        void UpdateLevels(Threading* threading);
+        void UpdateSubtrees(Threading* threading);
+        void UpdateSubtree(uint32_t transformIndex);
+        void UpdateTransform(uint32_t transformIndex);
+
+        template<typename Callback>
+        void ForEachInSubtree(uint32_t transformIndex, Callback& callback) const
+        {
+            callback(m_Transforms[transformIndex]);
+
+            const uint32_t childOffset = m_ChildOffsets[transformIndex];
+            for (uint32_t i = childOffset; i < childOffset + m_ChildCounts[transformIndex]; i++)
+            {
+                ForEachInSubtree(i, callback);
+            }
+        }
+
+    private:
+        enum class UpdateMode
+        {
+            None,
+            Levels,
+            Subtrees
+        };
+
+        static constexpr uint32_t m_InvalidIndex = ~0u;
+        static constexpr uint32_t m_LevelUpdateFraction = 8; // Past 1/8 of our transforms being dirty, a streaming pass over every level beats walking subtrees.
+
+        bool m_IsStale = true;
+        UpdateMode m_LastUpdate = UpdateMode::None;
+
+        std::vector<Transform*> m_Transforms;          // Depth order - every parent ahead of its children.
+        std::vector<uint32_t> m_ParentIndices;         // Parallel to m_Transforms. The parent's position within m_Transforms, or m_InvalidIndex for roots.
+        std::vector<uint32_t> m_ChildOffsets;          // As above. Where our children begin within m_Transforms.
+        std::vector<uint32_t> m_ChildCounts;           // As above.
+        std::vector<XMFLOAT4X4A> m_WorldMatrices;      // As above. Mirrors Transform::m_WorldMatrix.
+        std::vector<uint8_t> m_IsUpdated;              // As above. Whether the transform was recomputed during the current level update.
+        std::vector<uint32_t> m_LevelOffsets;          // Level n spans [m_LevelOffsets[n], m_LevelOffsets[n + 1]) of the arrays above.
+
+        Spinlock m_DirtyLock;
+        std::vector<uint32_t> m_DirtyIndices;          // Queued since our last update. May hold duplicates.
+        std::vector<uint32_t> m_SubtreeRoots;          // Rebuilt every update. Kept around to reuse its memory.
+    };
+}
@@ -3,6 +3,11 @@
 #include "World.h"
 #include "Components/Light.h"
 #include "Components/Camera.h"
+#include "Components/Renderable.h"
+#include "Components/RigidBody.h"
+#include "Components/Collider.h"
+#include "Components/AudioSource.h"
+#include "Components/Script.h"
 #include "../Renderer/Model.h"
 
 using namespace DirectX;
@@ -11,16 +16,31 @@ namespace Aurora
 {
     World::World(EngineContext* engineContext) : ISubsystem(engineContext)
     {
-
+        // Register a storage for every component type.
+        m_ComponentRegistry.Register<Camera>();
+        m_ComponentRegistry.Register<Light>();
+        m_ComponentRegistry.Register<Transform>();
+        m_ComponentRegistry.Register<RigidBody>();
+        m_ComponentRegistry.Register<Collider>();
+        m_ComponentRegistry.Register<Renderable>();
+        m_ComponentRegistry.Register<AudioSource>();
+        m_ComponentRegistry.Register<Script>();
     }
 
     World::~World()
     {
+        // Entities may be kept alive past us (such as by the editor's selection), hence we destroy their components while our storages are still around.
+        for (const std::shared_ptr<Entity>& entity : m_Entities)
+        {
+            entity->DetachFromWorld();
+        }
 
+        m_Entities.clear();
     }
 
     bool World::Initialize()
     {
+        m_Streamer = std::make_unique<WorldStreamer>(this, m_EngineContext->GetSubsystem<IOService>());
         SetWorldName(GetWorldName());
         CreateCamera();
         // CreateEnvironment();
@@ -74,33 +94,77 @@ namespace Aurora
                 }
             }
 
-            for (std::shared_ptr<Entity>& entity : m_Entities)
+            // Components are ticked a type at a time, in phases, rather than entity by entity. Each phase completes before the next begins, so a phase sees every
+            // write of the ones before it. Scripts have no component tick of their own, as they are run by the Scripting subsystem ahead of us.
+            Threading* threading = m_EngineContext->GetSubsystem<Threading>();
+
+            // Loaded scenes are linked in ahead of our phases as well, so that only our own thread ever changes our entities.
+            LinkPendingScene();
+
+            // Streamed cells are linked in ahead of our phases, so their entities are placed within the same tick. Linking is bounded by the streamer's frame budget.
+            if (m_Streamer->IsEnabled())
             {
-                if (entity)
-                {
-                    entity->Tick(deltaTime);
-                }
+                m_Streamer->Update(m_CameraPointer ? m_CameraPointer->GetTransform()->GetPosition() : XMFLOAT3(0.0f, 0.0f, 0.0f));
             }
+
+            // Rigid bodies only touch their own Bullet body when syncing to their transforms.
+            TickComponents<RigidBody>(threading, deltaTime);
+            // Only dirty transforms and their descendants are recomputed, split across jobs. See TransformHierarchy.h.
+            UpdateTransforms(threading);
+            // Cameras read input and write their own transforms, which are picked up next frame as before.
+            TickComponents<Camera>(threading, deltaTime);
+            // Lights may create GPU resources and audio sources drive the audio engine, neither of which we call into from several threads.
+            TickComponents<Light>(nullptr, deltaTime);
+            TickComponents<AudioSource>(nullptr, deltaTime);
         }
 
+        // Entities may also be marked for destruction directly, with the scene flagged dirty after. Pick those up alongside the ones removed through EntityRemove.
         if (m_IsSceneDirty)
         {
-            // Make a copy so we can iterate while removing entities.
-            std::vector<std::shared_ptr<Entity>> entitiesCopied = m_Entities;
-            
-            for (std::shared_ptr<Entity>& entity : entitiesCopied)
+            for (const std::shared_ptr<Entity>& entity : m_Entities)
             {
-                if (entity)
+                if (entity->IsPendingDestruction())
                 {
-                    if (entity->IsPendingDestruction())
-                    {
-                        _EntityRemove(entity);
-                    }
+                    QueueEntityDestruction(entity.get());
                 }
             }
         }
 
+        if (!m_PendingDestruction.empty())
+        {
+            ResolvePendingDestruction();
+        }
+
         m_IsSceneDirty = false;
+
+        // Everything recorded since our last tick, including the destruction resolved above.
+        m_ChangeJournal.Publish();
+    }
+
+    template<typename T>
+    void World::TickComponents(Threading* threading, float deltaTime)
+    {
+        const std::vector<T*>& components = m_ComponentRegistry.GetStorage<T>().GetComponents();
+        auto tickComponents = [&components, deltaTime](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                T* component = components[i];
+                if (component->GetEntity()->IsActive())
+                {
+                    component->T::Tick(deltaTime); // Qualified, as we know the exact type.
+                }
+            }
+        };
+
+        if (threading)
+        {
+            threading->ParallelForRange(static_cast<uint32_t>(components.size()), tickComponents);
+        }
+        else
+        {
+            tickComponents(0, static_cast<uint32_t>(components.size()));
+        }
     }
 
     void World::EntityRemove(const std::shared_ptr<Entity>& entity)
@@ -111,43 +175,99 @@ namespace Aurora
         }
 
         // We will simply mark the entity for destruction instead of outright deleting it. This is because the entity might still be in use. We thus remove it at the end of the frame.
-        entity->MarkForDestruction();
+        QueueEntityDestruction(entity.get());
+    }
 
-        m_IsSceneDirty = true;
+    void World::QueueEntityDestruction(Entity* entity)
+    {
+        EntitySlot* entitySlot = GetIndexedSlot(entity);
+        if (!entitySlot || entitySlot->m_IsQueuedForDestruction)
+        {
+            return;
+        }
+
+        entitySlot->m_IsQueuedForDestruction = true;
+        entity->MarkForDestruction();
+        m_PendingDestruction.emplace_back(entity->GetPointerShared());
     }
 
-    // Removes an entity and all of its children.
-    void World::_EntityRemove(const std::shared_ptr<Entity>& entity)
+    // Removes every entity queued for destruction, alongside their descendants. Each step is a single pass over the batch, so destroying n entities costs O(n) regardless
+    // of how many entities the world holds.
+    void World::ResolvePendingDestruction()
     {
-        // Remove any descendants.
-        std::vector<Transform*> children = entity->GetTransform()->GetChildren();
-        for (const auto& child : children)
+        // Descendants go with their ancestors. The batch grows as we walk it, hence children queued here have their own children picked up further down. Entities removed
+        // from the world since being queued are skipped throughout, as their components may already be gone.
+        for (size_t i = 0; i < m_PendingDestruction.size(); i++)
         {
-            EntityRemove(child->GetEntity()->GetPointerShared());
+            if (!IsQueuedForDestruction(m_PendingDestruction[i].get()))
+            {
+                continue;
+            }
+
+            for (Transform* childTransform : m_PendingDestruction[i]->GetTransform()->GetChildren())
+            {
+                QueueEntityDestruction(childTransform->GetEntity());
+            }
+        }
+
+        // Parents which survive the batch forget their destroyed children. Each is visited once no matter how many of its children go, so that clearing out the children of a
+        // single large parent doesn't search its child list once per child.
+        std::vector<Transform*> survivingParents;
+        for (const std::shared_ptr<Entity>& entity : m_PendingDestruction)
+        {
+            if (!IsQueuedForDestruction(entity.get()))
+            {
+                continue;
+            }
+
+            Transform* parentTransform = entity->GetTransform()->GetParentTransform();
+            if (parentTransform && !IsQueuedForDestruction(parentTransform->GetEntity()))
+            {
+                survivingParents.push_back(parentTransform);
+            }
         }
 
-        // Keep a reference to its parent (in case it has one).
-        Transform* parentEntity = entity->GetTransform()->GetParentTransform();
+        std::sort(survivingParents.begin(), survivingParents.end());
+        survivingParents.erase(std::unique(survivingParents.begin(), survivingParents.end()), survivingParents.end());
+        for (Transform* parentTransform : survivingParents)
+        {
+            parentTransform->RemoveChildTransforms([this](Transform* childTransform) { return IsQueuedForDestruction(childTransform->GetEntity()); });
+        }
 
-        // Remove this entity.
-        for (auto it = m_Entities.begin(); it < m_Entities.end();)
+        // Swap the last entity into each hole.
+        for (const std::shared_ptr<Entity>& entity : m_PendingDestruction)
         {
-            const std::shared_ptr<Entity> temporaryReference = *it;
-            if (temporaryReference->GetObjectID() == entity->GetObjectID())
+            EntitySlot* entitySlot = GetIndexedSlot(entity.get());
+            if (!entitySlot)
             {
-                // AURORA_ERROR("Matched! Deleting...");
-                it = m_Entities.erase(it);
-                break;
+                continue;
             }
 
-            ++it;
+            const uint32_t entityArrayIndex = entitySlot->m_EntityArrayIndex;
+            UnindexEntity(entity->GetEntityHandle().m_Index);
+
+            if (entityArrayIndex + 1 != m_Entities.size())
+            {
+                m_Entities[entityArrayIndex] = std::move(m_Entities.back());
+                m_EntitySlots[m_Entities[entityArrayIndex]->GetEntityHandle().m_Index].m_EntityArrayIndex = entityArrayIndex;
+            }
+            m_Entities.pop_back();
         }
 
-        // If there was a parent, update it.
-        if (parentEntity)
+        // Components and slots are returned now rather than with the last reference, as outside holders (such as a model's root or a prefab) may keep entities alive for
+        // longer. Otherwise their components would keep ticking, and their transforms would still be rebuilt while pointing at children freed within this very batch.
+        for (const std::shared_ptr<Entity>& entity : m_PendingDestruction)
         {
-            parentEntity->AcquireChildren();
+            entity->DetachFromWorld();
         }
+
+        m_PendingDestruction.clear();
+    }
+
+    bool World::IsQueuedForDestruction(const Entity* entity)
+    {
+        const EntitySlot* entitySlot = GetIndexedSlot(entity);
+        return entitySlot && entitySlot->m_IsQueuedForDestruction;
     }
 
     void World::New()
@@ -157,6 +277,12 @@ namespace Aurora
 
     void World::Clear()
     {
+        // Cells would otherwise believe themselves loaded after their entities are gone.
+        if (m_Streamer)
+        {
+            m_Streamer->Disable();
+        }
+
         AURORA_INFO(LogLayer::ECS, "%f", static_cast<float>(m_Entities.size()));
         for (int i = 0; i < m_Entities.size(); i++)
         {
@@ -166,7 +292,6 @@ namespace Aurora
             }
             else
             {
-                m_Entities[i]->MarkForDestruction();
                 EntityRemove(m_Entities[i]);
             }
         }
@@ -189,45 +314,444 @@ namespace Aurora
 
     std::shared_ptr<Entity> World::EntityCreate(bool isActive)
     {
-        std::shared_ptr<Entity> entity = m_Entities.emplace_back(std::make_shared<Entity>(m_EngineContext));
+        // Reserve a slot first, as the entity's components are stored under its slot index from construction onwards.
+        const EntityHandle entityHandle = AllocateEntityHandle(nullptr);
+        std::shared_ptr<Entity> entity = m_Entities.emplace_back(std::allocate_shared<Entity>(PoolAllocator<Entity>(m_EntityPools), m_EngineContext, entityHandle));
+        m_EntitySlots[entityHandle.m_Index].m_Entity = entity.get();
+        m_EntitySlots[entityHandle.m_Index].m_EntityArrayIndex = static_cast<uint32_t>(m_Entities.size() - 1);
+        IndexEntity(entityHandle.m_Index);
+        m_TransformHierarchy.Invalidate();
+
         entity->SetActive(isActive);
         return entity;
     }
 
-    bool World::EntityExists(const std::shared_ptr<Entity>& entity)
+    std::vector<std::shared_ptr<Entity>> World::Instantiate(const PrefabTemplate& prefabTemplate, uint32_t instanceCount, const PrefabInstanceTransform* instanceTransforms)
     {
-        if (!entity)
+        std::vector<std::shared_ptr<Entity>> rootEntities;
+        if (prefabTemplate.IsEmpty() || instanceCount == 0)
         {
-            return false;
+            return rootEntities;
         }
 
-        return GetEntityByID(entity->GetObjectID()) != nullptr;
+        const std::vector<PrefabTemplateEntity>& templateEntities = prefabTemplate.GetEntities();
+        const std::vector<PrefabTemplateComponent>& templateComponents = prefabTemplate.GetComponents();
+
+        rootEntities.reserve(static_cast<size_t>(prefabTemplate.GetRootCount()) * instanceCount);
+        m_Entities.reserve(m_Entities.size() + static_cast<size_t>(prefabTemplate.GetEntityCount()) * instanceCount);
+
+        std::vector<Transform*> instanceTransformComponents(templateEntities.size()); // The transform created for each template entity, for the instance at hand.
+        for (uint32_t instanceIndex = 0; instanceIndex < instanceCount; instanceIndex++)
+        {
+            for (uint32_t entityIndex = 0; entityIndex < templateEntities.size(); entityIndex++)
+            {
+                const PrefabTemplateEntity& templateEntity = templateEntities[entityIndex];
+
+                std::shared_ptr<Entity> entity = EntityCreate(templateEntity.m_IsActive);
+                entity->SetObjectID(Entity::GenerateObjectID());
+                entity->SetEntityName(templateEntity.m_Name);
+                entity->SetHierarchyVisibility(templateEntity.m_IsVisibleInHierarchy);
+
+                // Every entity comes with its transform, onto which we apply the template's values as with any other component.
+                for (uint32_t componentIndex = templateEntity.m_ComponentOffset; componentIndex < templateEntity.m_ComponentOffset + templateEntity.m_ComponentCount; componentIndex++)
+                {
+                    const PrefabTemplateComponent& templateComponent = templateComponents[componentIndex];
+                    IComponent* component = templateComponent.m_Type == ComponentType::Transform ? entity->GetTransform() : entity->AddComponent(templateComponent.m_Type);
+                    if (component)
+                    {
+                        component->SetAttributeValues(templateComponent.m_AttributeValues);
+                    }
+                }
+
+                Transform* transform = entity->GetTransform();
+                transform->m_Children.reserve(templateEntity.m_ChildCount);
+                instanceTransformComponents[entityIndex] = transform;
+
+                // Parents were created ahead of us and can't be our descendants, so we link directly rather than going through SetParentTransform's checks and updates.
+                // The change is still recorded for the child, as reparenting would.
+                if (templateEntity.m_ParentIndex != PrefabTemplate::m_InvalidIndex)
+                {
+                    Transform* parentTransform = instanceTransformComponents[templateEntity.m_ParentIndex];
+                    transform->m_ParentTransform = parentTransform;
+                    parentTransform->m_Children.emplace_back(transform);
+                    m_ChangeJournal.Record(WorldChangeType::HierarchyChanged, entity.get());
+                }
+                else
+                {
+                    if (instanceTransforms)
+                    {
+                        const PrefabInstanceTransform& instanceTransform = instanceTransforms[instanceIndex];
+                        transform->m_TranslationLocal = instanceTransform.m_Position;
+                        transform->m_RotationInRadians = instanceTransform.m_RotationInRadians;
+                        transform->m_ScaleLocal = instanceTransform.m_Scale;
+                    }
+
+                    rootEntities.emplace_back(std::move(entity));
+                }
+
+                // World matrices are computed with the rest of the hierarchy upon our next tick.
+                transform->SetDirty();
+            }
+        }
+
+        m_TransformHierarchy.Invalidate();
+        return rootEntities;
     }
 
-    const std::vector<std::shared_ptr<Entity>>& World::GetEntitiesByComponent(ComponentType componentType)
+    EntityHandle World::AllocateEntityHandle(Entity* entity)
     {
-        std::vector<std::shared_ptr<Entity>> componentEntities;
+        uint32_t slotIndex = m_FreeEntitySlot;
+        if (slotIndex != ~0u)
+        {
+            m_FreeEntitySlot = m_EntitySlots[slotIndex].m_NextFree;
+        }
+        else
+        {
+            slotIndex = static_cast<uint32_t>(m_EntitySlots.size());
+            m_EntitySlots.emplace_back();
+        }
 
-        for (const std::shared_ptr<Entity>& entity : m_Entities)
+        EntitySlot& slot = m_EntitySlots[slotIndex];
+        slot.m_Entity = entity;
+        slot.m_NextFree = ~0u;
+
+        return { slotIndex, slot.m_Generation };
+    }
+
+    void World::ReleaseEntityHandle(EntityHandle entityHandle)
+    {
+        if (entityHandle.m_Index >= m_EntitySlots.size() || m_EntitySlots[entityHandle.m_Index].m_Generation != entityHandle.m_Generation)
+        {
+            return;
+        }
+
+        // Only the case when the world itself is shutting down, as we otherwise hold a reference until removal.
+        if (m_EntitySlots[entityHandle.m_Index].m_IsIndexed)
+        {
+            UnindexEntity(entityHandle.m_Index);
+        }
+
+        // The entity's transform has left our storage.
+        m_TransformHierarchy.Invalidate();
+
+        EntitySlot& slot = m_EntitySlots[entityHandle.m_Index];
+        slot.m_Entity = nullptr;
+        slot.m_EntityArrayIndex = ~0u;
+        slot.m_Generation++;
+        slot.m_NextFree = m_FreeEntitySlot;
+        m_FreeEntitySlot = entityHandle.m_Index;
+    }
+
+    Entity* World::GetEntityByHandle(EntityHandle entityHandle) const
+    {
+        if (entityHandle.m_Index >= m_EntitySlots.size() || m_EntitySlots[entityHandle.m_Index].m_Generation != entityHandle.m_Generation)
+        {
+            return nullptr;
+        }
+
+        return m_EntitySlots[entityHandle.m_Index].m_Entity;
+    }
+
+    World::EntitySlot* World::GetIndexedSlot(const Entity* entity)
+    {
+        const EntityHandle entityHandle = entity->GetEntityHandle();
+        if (GetEntityByHandle(entityHandle) != entity || !m_EntitySlots[entityHandle.m_Index].m_IsIndexed)
         {
-            if (entity->HasComponent(componentType))
+            return nullptr;
+        }
+
+        return &m_EntitySlots[entityHandle.m_Index];
+    }
+
+    void World::IndexEntity(uint32_t slotIndex)
+    {
+        EntitySlot& entitySlot = m_EntitySlots[slotIndex];
+        m_EntitySlotsByID.emplace(entitySlot.m_Entity->GetObjectID(), slotIndex);
+        InsertEntityName(slotIndex, entitySlot.m_Entity->GetEntityName());
+        entitySlot.m_IsIndexed = true;
+
+        for (const std::unique_ptr<EntityQuery>& entityQuery : m_EntityQueries)
+        {
+            if (entityQuery->Matches(entitySlot.m_Entity->GetComponentMask()))
             {
-                componentEntities.emplace_back(entity);
+                entityQuery->Insert(entitySlot.m_Entity, slotIndex);
             }
         }
 
-        return componentEntities;
+        if (entitySlot.m_Entity->HasComponent(ComponentType::Renderable))
+        {
+            InsertBoundsProxy(slotIndex);
+        }
+
+        m_ChangeJournal.Record(WorldChangeType::EntityCreated, entitySlot.m_Entity);
     }
 
-    const std::shared_ptr<Entity>& World::GetEntityByName(const std::string& entityName)
+    void World::UnindexEntity(uint32_t slotIndex)
+    {
+        EntitySlot& entitySlot = m_EntitySlots[slotIndex];
+
+        // IDs are practically unique, so this range is almost always a single entry.
+        auto [rangeBegin, rangeEnd] = m_EntitySlotsByID.equal_range(entitySlot.m_Entity->GetObjectID());
+        for (auto it = rangeBegin; it != rangeEnd; ++it)
+        {
+            if (it->second == slotIndex)
+            {
+                m_EntitySlotsByID.erase(it);
+                break;
+            }
+        }
+
+        EraseEntityName(slotIndex, entitySlot.m_Entity->GetEntityName());
+        entitySlot.m_IsIndexed = false;
+        entitySlot.m_IsQueuedForDestruction = false;
+
+        for (const std::unique_ptr<EntityQuery>& entityQuery : m_EntityQueries)
+        {
+            entityQuery->Erase(slotIndex);
+        }
+
+        RemoveBoundsProxy(slotIndex);
+        m_ChangeJournal.Record(WorldChangeType::EntityDestroyed, entitySlot.m_Entity);
+    }
+
+    void World::UpdateEntityQueries(const Entity* entity, uint32_t previousComponentMask)
     {
+        EntitySlot* entitySlot = GetIndexedSlot(entity);
+        if (!entitySlot)
+        {
+            return;
+        }
+
+        const uint32_t slotIndex = entity->GetEntityHandle().m_Index;
+        for (const std::unique_ptr<EntityQuery>& entityQuery : m_EntityQueries)
+        {
+            const bool wasMatching = entityQuery->Matches(previousComponentMask);
+            const bool isMatching = entityQuery->Matches(entity->GetComponentMask());
+
+            if (isMatching && !wasMatching)
+            {
+                entityQuery->Insert(entitySlot->m_Entity, slotIndex);
+            }
+            else if (wasMatching && !isMatching)
+            {
+                entityQuery->Erase(slotIndex);
+            }
+        }
+
+        // Entities may gain or lose several components at once, such as when their component mask is restored wholesale.
+        const uint32_t changedComponentMask = previousComponentMask ^ entity->GetComponentMask();
+        for (uint32_t componentIndex = 0; componentIndex < static_cast<uint32_t>(ComponentType::Unknown); componentIndex++)
+        {
+            const ComponentType componentType = static_cast<ComponentType>(componentIndex);
+            if (changedComponentMask & Entity::GetComponentMask(componentType))
+            {
+                m_ChangeJournal.Record(entity->HasComponent(componentType) ? WorldChangeType::ComponentAdded : WorldChangeType::ComponentRemoved, entity, componentType);
+            }
+        }
+
+        const uint32_t renderableMask = Entity::GetComponentMask(ComponentType::Renderable);
+        if ((entity->GetComponentMask() & renderableMask) && !(previousComponentMask & renderableMask))
+        {
+            InsertBoundsProxy(slotIndex);
+        }
+        else if (!(entity->GetComponentMask() & renderableMask) && (previousComponentMask & renderableMask))
+        {
+            RemoveBoundsProxy(slotIndex);
+        }
+    }
+
+    void World::InsertBoundsProxy(uint32_t slotIndex)
+    {
+        EntitySlot& entitySlot = m_EntitySlots[slotIndex];
+        if (entitySlot.m_BoundsProxy == BoundingVolumeHierarchy::m_InvalidProxy)
+        {
+            entitySlot.m_BoundsProxy = m_SpatialIndex.Insert(entitySlot.m_Entity->GetComponent<Renderable>()->GetWorldBounds(), slotIndex);
+        }
+    }
+
+    void World::RemoveBoundsProxy(uint32_t slotIndex)
+    {
+        EntitySlot& entitySlot = m_EntitySlots[slotIndex];
+        if (entitySlot.m_BoundsProxy != BoundingVolumeHierarchy::m_InvalidProxy)
+        {
+            m_SpatialIndex.Remove(entitySlot.m_BoundsProxy);
+            entitySlot.m_BoundsProxy = BoundingVolumeHierarchy::m_InvalidProxy;
+        }
+    }
+
+    void World::UpdateTransforms(Threading* threading)
+    {
+        m_TransformHierarchy.Update(m_ComponentRegistry.GetStorage<Transform>(), threading);
+        ProcessUpdatedTransforms();
+    }
+
+    void World::ProcessUpdatedTransforms()
+    {
+        // Proxies only move once their bounds leave the fat bounds, so most refits end at a containment test.
+        m_TransformHierarchy.ForEachUpdatedTransform([this](Transform* transform)
+        {
+            Entity* entity = transform->GetEntity();
+            const uint32_t boundsProxy = m_EntitySlots[entity->GetEntityHandle().m_Index].m_BoundsProxy;
+            if (boundsProxy != BoundingVolumeHierarchy::m_InvalidProxy)
+            {
+                m_SpatialIndex.Move(boundsProxy, entity->GetComponent<Renderable>()->GetWorldBounds());
+            }
+
+            m_ChangeJournal.Record(WorldChangeType::TransformUpdated, entity);
+        });
+    }
+
+    void World::InvalidateTransformHierarchy(const Entity* reparentedEntity)
+    {
+        m_TransformHierarchy.Invalidate();
+        m_ChangeJournal.Record(WorldChangeType::HierarchyChanged, reparentedEntity);
+    }
+
+    void World::QueryEntitiesInBox(const BoundingBox& bounds, std::vector<Entity*>* entities) const
+    {
+        m_SpatialIndex.QueryBox(bounds, [this, entities](uint32_t slotIndex) { entities->push_back(m_EntitySlots[slotIndex].m_Entity); });
+    }
+
+    void World::QueryEntitiesInSphere(const Vector3& center, float radius, std::vector<Entity*>* entities) const
+    {
+        m_SpatialIndex.QuerySphere(center, radius, [this, entities](uint32_t slotIndex) { entities->push_back(m_EntitySlots[slotIndex].m_Entity); });
+    }
+
+    void World::QueryEntitiesInFrustum(const XMMATRIX& viewProjectionMatrix, std::vector<Entity*>* entities) const
+    {
+        m_SpatialIndex.QueryFrustum(viewProjectionMatrix, [this, entities](uint32_t slotIndex) { entities->push_back(m_EntitySlots[slotIndex].m_Entity); });
+    }
+
+    Entity* World::QueryClosestEntityOnRay(const Ray& ray, float* hitDistance) const
+    {
+        Entity* closestEntity = nullptr;
+        float closestDistance = Helper::Infinity;
+
+        // Fat bounds merely nominate candidates. Those that are nearer than our closest hit so far are tested against their exact bounds.
+        m_SpatialIndex.QueryRay(ray, [this, &ray, &closestEntity, &closestDistance](uint32_t slotIndex, float fatDistance)
+        {
+            if (fatDistance >= closestDistance)
+            {
+                return;
+            }
+
+            Entity* entity = m_EntitySlots[slotIndex].m_Entity;
+            const float distance = ray.HitDistance(entity->GetComponent<Renderable>()->GetWorldBounds());
+            if (distance < closestDistance && distance <= ray.GetLength())
+            {
+                closestEntity = entity;
+                closestDistance = distance;
+            }
+        });
+
+        if (hitDistance)
+        {
+            *hitDistance = closestDistance;
+        }
+
+        return closestEntity;
+    }
+
+    EntityQuery& World::GetEntityQuery(uint32_t componentMask)
+    {
+        for (const std::unique_ptr<EntityQuery>& entityQuery : m_EntityQueries)
+        {
+            if (entityQuery->GetComponentMask() == componentMask)
+            {
+                return *entityQuery;
+            }
+        }
+
+        // A new query is filled once, and kept up to date incrementally from then on.
+        EntityQuery& entityQuery = *m_EntityQueries.emplace_back(std::make_unique<EntityQuery>(componentMask));
         for (const std::shared_ptr<Entity>& entity : m_Entities)
         {
-            if (entity->GetEntityName() == entityName)
+            if (entityQuery.Matches(entity->GetComponentMask()))
             {
-                return entity;
+                entityQuery.Insert(entity.get(), entity->GetEntityHandle().m_Index);
             }
         }
+
+        return entityQuery;
+    }
+
+    void World::ReindexEntityID(const Entity* entity, uint32_t newEntityID)
+    {
+        if (!GetIndexedSlot(entity) || entity->GetObjectID() == newEntityID)
+        {
+            return;
+        }
+
+        const uint32_t slotIndex = entity->GetEntityHandle().m_Index;
+        auto [rangeBegin, rangeEnd] = m_EntitySlotsByID.equal_range(entity->GetObjectID());
+        for (auto it = rangeBegin; it != rangeEnd; ++it)
+        {
+            if (it->second == slotIndex)
+            {
+                m_EntitySlotsByID.erase(it);
+                break;
+            }
+        }
+
+        m_EntitySlotsByID.emplace(newEntityID, slotIndex);
+    }
+
+    void World::ReindexEntityName(const Entity* entity, const std::string& newEntityName)
+    {
+        if (!GetIndexedSlot(entity) || entity->GetEntityName() == newEntityName)
+        {
+            return;
+        }
+
+        EraseEntityName(entity->GetEntityHandle().m_Index, entity->GetEntityName());
+        InsertEntityName(entity->GetEntityHandle().m_Index, newEntityName);
+    }
+
+    void World::InsertEntityName(uint32_t slotIndex, const std::string& entityName)
+    {
+        std::vector<uint32_t>& nameBucket = m_EntitySlotsByName[entityName];
+        m_EntitySlots[slotIndex].m_NameBucketPosition = static_cast<uint32_t>(nameBucket.size());
+        nameBucket.push_back(slotIndex);
+    }
+
+    void World::EraseEntityName(uint32_t slotIndex, const std::string& entityName)
+    {
+        auto nameBucket = m_EntitySlotsByName.find(entityName);
+        if (nameBucket == m_EntitySlotsByName.end())
+        {
+            return;
+        }
+
+        // Swap the last slot of the bucket into our position.
+        std::vector<uint32_t>& bucketSlots = nameBucket->second;
+        const uint32_t bucketPosition = m_EntitySlots[slotIndex].m_NameBucketPosition;
+        bucketSlots[bucketPosition] = bucketSlots.back();
+        m_EntitySlots[bucketSlots[bucketPosition]].m_NameBucketPosition = bucketPosition;
+        bucketSlots.pop_back();
+        m_EntitySlots[slotIndex].m_NameBucketPosition = ~0u;
+
+        if (bucketSlots.empty())
+        {
+            m_EntitySlotsByName.erase(nameBucket);
+        }
+    }
+
+    bool World::EntityExists(const std::shared_ptr<Entity>& entity)
+    {
+        if (!entity)
+        {
+            return false;
+        }
+
+        return GetIndexedSlot(entity.get()) != nullptr;
+    }
+
+    const std::shared_ptr<Entity>& World::GetEntityByName(const std::string& entityName)
+    {
+        if (auto nameBucket = m_EntitySlotsByName.find(entityName); nameBucket != m_EntitySlotsByName.end())
+        {
+            return m_Entities[m_EntitySlots[nameBucket->second.front()].m_EntityArrayIndex];
+        }
         
         AURORA_ERROR(LogLayer::ECS, "Entity not found!");
         static std::shared_ptr<Entity> emptyEntity;
@@ -236,12 +760,9 @@ namespace Aurora
 
     const std::shared_ptr<Entity>& World::GetEntityByID(uint32_t entityID)
     {
-        for (const std::shared_ptr<Entity>& entity : m_Entities)
+        if (auto entitySlot = m_EntitySlotsByID.find(entityID); entitySlot != m_EntitySlotsByID.end())
         {
-            if (entity->GetObjectID() == entityID)
-            {
-                return entity;
-            }
+            return m_Entities[m_EntitySlots[entitySlot->second].m_EntityArrayIndex];
         }
 
         static std::shared_ptr<Entity> emptyEntity;
@@ -293,35 +814,64 @@ namespace Aurora
         }
 
         // Only save root entities as they will also save their descendants.
-        auto rootEntities = EntityGetRoots();
+        SerializeRootEntities(fileSerializer.get(), EntityGetRoots());
+
+        /// Notify subsystems waiting for us to finish.
+
+        return true;
+    }
+
+    void World::SerializeRootEntities(BinarySerializer* binarySerializer, const std::vector<std::shared_ptr<Entity>>& rootEntities)
+    {
         const uint32_t rootEntityCount = static_cast<uint32_t>(rootEntities.size());
 
         /// Progress tracking.
 
         // Save root entity count.
-        fileSerializer->Write(rootEntityCount);
+        binarySerializer->Write(rootEntityCount);
 
         // Save root entity IDs.
         for (const auto& rootEntity : rootEntities)
         {
-            fileSerializer->Write(rootEntity->GetObjectID());
+            binarySerializer->Write(rootEntity->GetObjectID());
         }
 
         // Save the root entities themselves.
         for (const auto& rootEntity : rootEntities)
         {
-            rootEntity->Serialize(fileSerializer.get());
+            rootEntity->Serialize(binarySerializer);
             /// Progress tracking.
         }
+    }
+
+    std::vector<std::shared_ptr<Entity>> World::DeserializeRootEntities(BinarySerializer* binaryDeserializer)
+    {
+        // Load root entity count.
+        const uint32_t rootEntityCount = binaryDeserializer->ReadAs<uint32_t>();
+
+        // Load root entity IDs.
+        std::vector<std::shared_ptr<Entity>> rootEntities;
+        rootEntities.reserve(rootEntityCount);
+        for (uint32_t i = 0; i < rootEntityCount; i++)
+        {
+            std::shared_ptr<Entity> entity = EntityCreate();
+            entity->SetObjectID(binaryDeserializer->ReadAs<uint32_t>());
+            rootEntities.emplace_back(entity);
+        }
 
-        /// Notify subsystems waiting for us to finish.
+        // Deserialize root entities. Parents are resolved by ID as we go, which our index keeps at constant time per entity.
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            rootEntity->Deserialize(binaryDeserializer, nullptr);
+            /// Tracker.
+        }
 
-        return true;
+        return rootEntities;
     }
 
-    bool World::DeserializeScene(const std::string& filePath)
+    bool World::DeserializeScene(const std::string& filePath, const std::vector<uint8_t>* fileData)
     {
-        if (!FileSystem::Exists(filePath))
+        if (!fileData && !FileSystem::Exists(filePath))
         {
             AURORA_ERROR(LogLayer::Serialization, "%s was not found.", filePath.c_str());
             return false;
@@ -335,7 +885,7 @@ namespace Aurora
         }
 
         // Open file.
-        std::unique_ptr<BinarySerializer> binaryDeserializer = std::make_unique<BinarySerializer>(filePath, SerializerFlag::SerializerMode_Read);
+        std::unique_ptr<BinarySerializer> binaryDeserializer = fileData ? std::make_unique<BinarySerializer>(*fileData) : std::make_unique<BinarySerializer>(filePath, SerializerFlag::SerializerMode_Read);
         if (!binaryDeserializer->IsStreamOpen())
         {
             return false;
@@ -355,24 +905,46 @@ namespace Aurora
         m_EngineContext->GetSubsystem<ResourceCache>()->LoadResourcesFromFiles();
         
 
-        // Load root entity count.
-        const uint32_t rootEntityCount = binaryDeserializer->ReadAs<uint32_t>();
+        // Our cleared entities are only removed at the end of the frame, hence the new roots are tracked by themselves rather than by position in m_Entities.
+        DeserializeRootEntities(binaryDeserializer.get());
 
-        // Load root entity IDs.
-        for (uint32_t i = 0; i < rootEntityCount; i++)
+        return true;
+    }
+
+    void World::LoadScene(const std::string& filePath)
+    {
+        PendingSceneLoad sceneLoad;
+        sceneLoad.m_FilePath = filePath;
+        sceneLoad.m_FileData = std::make_shared<std::vector<uint8_t>>();
+
+        // The completion does nothing but hold on to the buffer being read into, in case we let go of it first.
+        sceneLoad.m_ReadHandle = m_EngineContext->GetSubsystem<IOService>()->ReadFile(filePath, sceneLoad.m_FileData.get(), [fileData = sceneLoad.m_FileData](IOBatch& ioBatch) {}, JobPriority::Background);
+
+        std::lock_guard<std::mutex> lock(m_PendingSceneMutex);
+        m_PendingSceneLoad = std::move(sceneLoad);
+    }
+
+    void World::LinkPendingScene()
+    {
+        PendingSceneLoad sceneLoad;
         {
-            std::shared_ptr<Entity> entity = EntityCreate();
-            entity->SetObjectID(binaryDeserializer->ReadAs<uint32_t>());
+            std::lock_guard<std::mutex> lock(m_PendingSceneMutex);
+            if (!m_PendingSceneLoad.m_ReadHandle || !m_EngineContext->GetSubsystem<IOService>()->IsComplete(m_PendingSceneLoad.m_ReadHandle))
+            {
+                return;
+            }
+
+            sceneLoad = std::move(m_PendingSceneLoad);
+            m_PendingSceneLoad = PendingSceneLoad();
         }
 
-        // Deserialize root entities.
-        for (uint32_t i = 0; i < rootEntityCount; i++)
+        if (!sceneLoad.m_ReadHandle->IsSuccessful())
         {
-            m_Entities[i]->Deserialize(binaryDeserializer.get(), nullptr);
-            /// Tracker.
+            AURORA_ERROR(LogLayer::Serialization, "Failed to read scene \"%s\".", sceneLoad.m_FilePath.c_str());
+            return;
         }
 
-        return true;
+        DeserializeScene(sceneLoad.m_FilePath, sceneLoad.m_FileData.get());
     }
 
     void World::SetWorldName(const std::string& worldName)
@@ -1,12 +1,23 @@
 #pragma once
+#include <mutex>
+#include <unordered_map>
 #include "EngineContext.h"
 #include "ISubsystem.h"
 #include "Entity.h"
+#include "EntityQuery.h"
+#include "TransformHierarchy.h"
+#include "BoundingVolumeHierarchy.h"
+#include "WorldChangeJournal.h"
+#include "WorldStreamer.h"
+#include "PrefabTemplate.h"
+#include "../Utilities/Memory/BlockPool.h"
 #include "../Serializer/Serializer.h"
 #include "../Resource/ResourceCache.h"
 
 namespace Aurora
 {
+    class Threading;
+
     class World : public ISubsystem
     {
     public:
@@ -15,10 +26,23 @@ namespace Aurora
 
         bool Initialize() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override
+        {
+            // Components are ticked by type, polling input, stepping audio clips, syncing rigid bodies and lazily creating light resources. See World::Tick for phases.
+            SubsystemTickAccess tickAccess;
+            tickAccess.m_Reads = SubsystemResource_Time | SubsystemResource_Input;
+            tickAccess.m_Writes = SubsystemResource_Entities | SubsystemResource_Transforms | SubsystemResource_Physics | SubsystemResource_Audio | SubsystemResource_Scripts | SubsystemResource_Rendering;
+            tickAccess.m_RequiresMainThread = false;
+
+            return tickAccess;
+        }
 
         // Loading/Deserializing
         bool SerializeScene(const std::string& filePath);
-        bool DeserializeScene(const std::string& filePath);
+        bool DeserializeScene(const std::string& filePath, const std::vector<uint8_t>* fileData = nullptr); // Deserializes from fileData instead of reading the file if given, such as when streamed in through the IOService.
+        void LoadScene(const std::string& filePath); // May be called from any thread. Reads the scene through the IOService, then deserializes it within our first tick after. Replaces any load still reading.
+        void SerializeRootEntities(BinarySerializer* binarySerializer, const std::vector<std::shared_ptr<Entity>>& rootEntities); // Writes the given roots and their descendants.
+        std::vector<std::shared_ptr<Entity>> DeserializeRootEntities(BinarySerializer* binaryDeserializer); // Creates the entities written by the above, returning the roots.
 
         // Entity
         void New();
@@ -33,12 +57,47 @@ namespace Aurora
         bool EntityExists(const std::shared_ptr<Entity>& entity);
         void EntityRemove(const std::shared_ptr<Entity>& entity);
 
-        const std::vector<std::shared_ptr<Entity>>& GetEntitiesByComponent(ComponentType componentType);
-        const std::shared_ptr<Entity>& GetEntityByName(const std::string& entityName);
-        const std::shared_ptr<Entity>& GetEntityByID(uint32_t entityID);
+        // Creates instanceCount copies of the template's hierarchies in a single pass, returning the roots of every instance in order. Roots take their local transform
+        // from instanceTransforms (one per instance) if given, or from the template otherwise. See PrefabTemplate.h.
+        std::vector<std::shared_ptr<Entity>> Instantiate(const PrefabTemplate& prefabTemplate, uint32_t instanceCount, const PrefabInstanceTransform* instanceTransforms = nullptr);
+
+        // Queries - See EntityQuery.h. Created upon first request and kept up to date from then on.
+        EntityQuery& GetEntityQuery(uint32_t componentMask);
+
+        template<typename... Components>
+        EntityQuery& GetEntityQuery() { return GetEntityQuery((Entity::GetComponentMask(IComponent::TypeToEnum<Components>()) | ...)); }
+
+        const std::vector<Entity*>& GetEntitiesByComponent(ComponentType componentType) { return GetEntityQuery(Entity::GetComponentMask(componentType)).GetEntities(); }
+        const std::shared_ptr<Entity>& GetEntityByName(const std::string& entityName); // O(1) - Returns any entity with the given name should there be several.
+        const std::shared_ptr<Entity>& GetEntityByID(uint32_t entityID);               // O(1)
         const std::vector<std::shared_ptr<Entity>>& EntityGetAll() const { return m_Entities; }
         std::vector<std::shared_ptr<Entity>> EntityGetRoots();
 
+        // Handles & Component Storage - See ComponentStorage.h.
+        Entity* GetEntityByHandle(EntityHandle entityHandle) const; // Returns nullptr for handles of destroyed entities.
+        bool IsEntityHandleValid(EntityHandle entityHandle) const { return GetEntityByHandle(entityHandle) != nullptr; }
+        ComponentRegistry& GetComponentRegistry() { return m_ComponentRegistry; }
+
+        template<typename T>
+        ComponentStorage<T>& GetComponentStorage() { return m_ComponentRegistry.GetStorage<T>(); }
+
+        // Transform Hierarchy - See TransformHierarchy.h. Transforms call this as they are reparented, naming the entity whose parent or children changed.
+        void InvalidateTransformHierarchy(const Entity* reparentedEntity);
+
+        // Streaming - Loads and unloads cells of entities around our camera. See WorldStreamer.h. Clearing the world disables streaming.
+        WorldStreamer* GetStreamer() { return m_Streamer.get(); }
+
+        // Change Journal - What changed over the last frame. See WorldChangeJournal.h.
+        const WorldChangeJournal& GetChangeJournal() const { return m_ChangeJournal; }
+
+        // Spatial Queries - Renderable entities are indexed by their world bounds, refit as their transforms are updated. See BoundingVolumeHierarchy.h. Results are
+        // appended to the given vector, which callers may reuse across frames. Proxies are fat, hence entities within a small margin of the volume are returned as well.
+        void QueryEntitiesInBox(const BoundingBox& bounds, std::vector<Entity*>* entities) const;
+        void QueryEntitiesInSphere(const Vector3& center, float radius, std::vector<Entity*>* entities) const;
+        void QueryEntitiesInFrustum(const XMMATRIX& viewProjectionMatrix, std::vector<Entity*>* entities) const;
+        Entity* QueryClosestEntityOnRay(const Ray& ray, float* hitDistance = nullptr) const; // Tested against exact bounds. Returns nullptr should nothing be hit.
+        const BoundingVolumeHierarchy& GetSpatialIndex() const { return m_SpatialIndex; }
+
         bool CreateDefaultObject(DefaultObjectType defaultObjectType);
 
         void SetWorldName(const std::string& worldName);
@@ -49,7 +108,52 @@ namespace Aurora
         Entity* m_CameraPointer;
 
     private:
-        void _EntityRemove(const std::shared_ptr<Entity>& entity);
+        // Entity slots, indexed by EntityHandle::m_Index. Released slots are chained into a free list and reused.
+        struct EntitySlot
+        {
+            Entity* m_Entity = nullptr;
+            uint32_t m_Generation = 0;
+            uint32_t m_NextFree = ~0u;
+            uint32_t m_EntityArrayIndex = ~0u;     // Position within m_Entities.
+            uint32_t m_NameBucketPosition = ~0u;   // Position within our name's bucket of m_EntitySlotsByName.
+            bool m_IsIndexed = false;              // Whether we are in m_Entities and the lookup indices.
+            bool m_IsQueuedForDestruction = false; // Whether we are in m_PendingDestruction.
+            uint32_t m_BoundsProxy = BoundingVolumeHierarchy::m_InvalidProxy; // Within m_SpatialIndex, whilst we are indexed and have a renderable.
+        };
+
+        friend class Entity;
+        friend class WorldBenchmark; // Times our tick phases and destruction on their own, going through nothing else of ours.
+
+        // Tick Phases - Each returns once every component of the phase is ticked. Pass no threading to tick on the calling thread.
+        template<typename T>
+        void TickComponents(Threading* threading, float deltaTime);
+        void UpdateTransforms(Threading* threading); // Recomputes dirty transforms and their descendants, then refits and journals what moved.
+
+        // Destruction - Entities are queued during the frame and removed in a single batch at its end.
+        void QueueEntityDestruction(Entity* entity);
+        void ResolvePendingDestruction();
+        bool IsQueuedForDestruction(const Entity* entity);
+
+        EntityHandle AllocateEntityHandle(Entity* entity);
+        void ReleaseEntityHandle(EntityHandle entityHandle); // Called by entities upon detaching from us.
+
+        // Lookup Indices - Kept in sync by entities as their IDs and names change.
+        void IndexEntity(uint32_t slotIndex);
+        void UnindexEntity(uint32_t slotIndex);
+        void ReindexEntityID(const Entity* entity, uint32_t newEntityID);
+        void ReindexEntityName(const Entity* entity, const std::string& newEntityName);
+        void InsertEntityName(uint32_t slotIndex, const std::string& entityName);
+        void EraseEntityName(uint32_t slotIndex, const std::string& entityName);
+        EntitySlot* GetIndexedSlot(const Entity* entity);
+        void UpdateEntityQueries(const Entity* entity, uint32_t previousComponentMask);
+
+        // Spatial Index
+        void InsertBoundsProxy(uint32_t slotIndex);
+        void RemoveBoundsProxy(uint32_t slotIndex);
+        void ProcessUpdatedTransforms(); // Refits bounds proxies and journals the transforms recomputed by the hierarchy's last update.
+
+        // Scene Loading
+        void LinkPendingScene(); // Deserializes the scene given to LoadScene() once it has been read.
 
         // Default Components
         void CreateDirectionalLight();
@@ -63,6 +167,34 @@ namespace Aurora
         bool m_IsSceneDirty = true;
         bool m_WasInEditorMode = false;
 
-        std::vector<std::shared_ptr<Entity>> m_Entities;
+        ComponentRegistry m_ComponentRegistry; // Declared ahead of our entities, so it outlives them.
+        std::shared_ptr<BlockPoolSet> m_EntityPools = std::make_shared<BlockPoolSet>(); // Entities (alongside their shared_ptr control blocks) and index nodes. See BlockPool.h.
+        std::vector<EntitySlot> m_EntitySlots;
+        uint32_t m_FreeEntitySlot = ~0u;
+
+        // Object ID and name to entity slot. IDs are expected to be unique but are randomly generated, hence the multimap. Names are commonly shared (every entity starts out
+        // as "Entity"), so each name keeps a bucket of slots which entities are swapped out of in constant time.
+        using EntityIDIndex = std::unordered_multimap<uint32_t, uint32_t, std::hash<uint32_t>, std::equal_to<uint32_t>, PoolAllocator<std::pair<const uint32_t, uint32_t>>>;
+        EntityIDIndex m_EntitySlotsByID{ 0, std::hash<uint32_t>(), std::equal_to<uint32_t>(), PoolAllocator<std::pair<const uint32_t, uint32_t>>(m_EntityPools) };
+        std::unordered_map<std::string, std::vector<uint32_t>> m_EntitySlotsByName;
+        std::vector<std::unique_ptr<EntityQuery>> m_EntityQueries; // Few in number, hence searched linearly.
+        TransformHierarchy m_TransformHierarchy;
+        BoundingVolumeHierarchy m_SpatialIndex; // Leaves hold entity slot indices.
+        WorldChangeJournal m_ChangeJournal;
+
+        // A scene read through LoadScene(), deserialized by our tick once read. The buffer is shared with the read's completion, so it outlives the read even once replaced.
+        struct PendingSceneLoad
+        {
+            std::string m_FilePath;
+            std::shared_ptr<std::vector<uint8_t>> m_FileData;
+            IOHandle m_ReadHandle;
+        };
+
+        std::mutex m_PendingSceneMutex;
+        PendingSceneLoad m_PendingSceneLoad;
+
+        std::vector<std::shared_ptr<Entity>> m_Entities; // Unordered - removal swaps the last entity into the hole.
+        std::vector<std::shared_ptr<Entity>> m_PendingDestruction;
+        std::unique_ptr<WorldStreamer> m_Streamer; // Declared last, so that it waits on its reads before anything else goes.
     };
 }
\ No newline at end of file
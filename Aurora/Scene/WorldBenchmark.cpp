@@ -0,0 +1,946 @@
+#include "Aurora.h"
+#include "WorldBenchmark.h"
+#include "World.h"
+#include "Components/Renderable.h"
+#include "Components/Camera.h"
+#include "Components/Light.h"
+#include "Components/RigidBody.h"
+#include "Components/Script.h"
+#include "../Resource/Prefab.h"
+#include "../Threading/Threading.h"
+#include "../Utilities/Memory/AllocationTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+namespace Aurora
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    static double ElapsedMilliseconds(const BenchmarkClock::time_point& startTime)
+    {
+        return std::chrono::duration<double, std::milli>(BenchmarkClock::now() - startTime).count();
+    }
+
+    WorldBenchmark::WorldBenchmark(EngineContext* engineContext)
+    {
+        m_EngineContext = engineContext;
+        m_World = m_EngineContext->GetSubsystem<World>();
+    }
+
+    void WorldBenchmark::Run()
+    {
+        m_DeserializationResults.clear();
+        for (uint32_t entityCount : { 1000u, 10000u, 100000u })
+        {
+            WorldBenchmarkDeserializationResult result = MeasureDeserialization(entityCount);
+            if (!m_DeserializationResults.empty())
+            {
+                result.m_DeserializeScaling = result.m_DeserializeNanosecondsPerEntity / m_DeserializationResults.front().m_DeserializeNanosecondsPerEntity;
+            }
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Entities): Create %.2fms, Serialize %.2fms, Deserialize %.2fms (%.1fns/entity, %.2fx of smallest)%s.",
+                        entityCount, result.m_CreateMilliseconds, result.m_SerializeMilliseconds, result.m_DeserializeMilliseconds, result.m_DeserializeNanosecondsPerEntity,
+                        result.m_DeserializeScaling, result.m_IsHierarchyValid ? "" : " - Hierarchy Mismatch");
+
+            m_DeserializationResults.push_back(result);
+        }
+
+        FileSystem::Delete(m_ScenePath);
+
+        m_DestructionResults.clear();
+        for (uint32_t entityCount : { 10000u, 50000u, 100000u })
+        {
+            WorldBenchmarkDestructionResult result = MeasureDestruction(entityCount);
+            if (!m_DestructionResults.empty())
+            {
+                result.m_DestroyScaling = result.m_DestroyNanosecondsPerEntity / m_DestructionResults.front().m_DestroyNanosecondsPerEntity;
+            }
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Entities): Destroy Children %.2fms, Destroy Roots %.2fms (%.1fns/entity, %.2fx of smallest)%s.",
+                        entityCount, result.m_DestroyChildrenMilliseconds, result.m_DestroyRootsMilliseconds, result.m_DestroyNanosecondsPerEntity, result.m_DestroyScaling,
+                        result.m_IsWorldValid ? "" : " - World Mismatch");
+
+            m_DestructionResults.push_back(result);
+        }
+
+        m_InstantiationResults.clear();
+        for (uint32_t instanceCount : { 1000u, 10000u })
+        {
+            const WorldBenchmarkInstantiationResult result = MeasureInstantiation(instanceCount);
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Prefab Instances): Instantiate %.2fms (%.1fns/instance), File Load %.1fns/instance%s.",
+                        instanceCount, result.m_InstantiateMilliseconds, result.m_InstantiateNanosecondsPerInstance, result.m_FileLoadNanosecondsPerInstance,
+                        result.m_IsHierarchyValid ? "" : " - Hierarchy Mismatch");
+
+            m_InstantiationResults.push_back(result);
+        }
+
+        FileSystem::Delete(m_PrefabPath);
+
+        m_SpawnResults.clear();
+        if (!AllocationTracker::IsTracking())
+        {
+            AURORA_WARNING(LogLayer::ECS, "World Benchmark: Allocations are only counted in builds defining AURORA_TRACK_ALLOCATIONS, and read as 0 here.");
+        }
+
+        for (uint32_t entityCount : { 10000u, 100000u })
+        {
+            const WorldBenchmarkSpawnResult result = MeasureSpawn(entityCount);
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Entities): Spawn %.2fms (%.2f allocations/entity), Despawn %.2fms, Warm Spawn %.2fms (%.2f allocations/entity).",
+                        entityCount, result.m_SpawnMilliseconds, result.m_AllocationsPerEntity, result.m_DespawnMilliseconds, result.m_WarmSpawnMilliseconds, result.m_WarmAllocationsPerEntity);
+
+            m_SpawnResults.push_back(result);
+        }
+
+        m_SpatialQueryResults.clear();
+        for (uint32_t entityCount : { 1000u, 10000u, 100000u })
+        {
+            const WorldBenchmarkSpatialQueryResult result = MeasureSpatialQueries(entityCount);
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Renderables): Insert %.2fms, Refit %.2fms, Box Query %.1fns (Linear %.1fns), Ray Query %.1fns (Linear %.1fns), Height %u%s.",
+                        entityCount, result.m_InsertMilliseconds, result.m_RefitMilliseconds, result.m_BoxQueryNanoseconds, result.m_LinearBoxQueryNanoseconds,
+                        result.m_RayQueryNanoseconds, result.m_LinearRayQueryNanoseconds, result.m_TreeHeight, result.m_AreResultsValid ? "" : " - Result Mismatch");
+
+            m_SpatialQueryResults.push_back(result);
+        }
+
+        m_StreamingResults.clear();
+        for (uint32_t entityCount : { 10000u, 100000u })
+        {
+            const WorldBenchmarkStreamingResult result = MeasureStreaming(entityCount);
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Streamed Entities, %u Cells): Save %.2fms, Stream In %.2fms over %u updates (peak %.2fms against a %.2fms budget), Unload %.2fms%s.",
+                        entityCount, result.m_CellCount, result.m_SaveMilliseconds, result.m_StreamInMilliseconds, result.m_UpdateCount, result.m_PeakLinkMilliseconds,
+                        result.m_FrameBudgetMilliseconds, result.m_UnloadMilliseconds, result.m_IsWorldValid ? "" : " - World Mismatch");
+
+            m_StreamingResults.push_back(result);
+        }
+
+        FileSystem::Delete(m_CellDirectory);
+    }
+
+    void WorldBenchmark::RunLargeScenes(const std::vector<uint32_t>& entityCounts, const SceneGeneratorSettings& sceneSettings)
+    {
+        m_LargeSceneResults.clear();
+        m_LargeSceneSettings = sceneSettings;
+
+        for (uint32_t entityCount : entityCounts)
+        {
+            SceneGeneratorSettings generatorSettings = sceneSettings;
+            generatorSettings.m_EntityCount = entityCount;
+            generatorSettings.m_FirstEntityID = m_NextEntityID;
+            const WorldBenchmarkLargeSceneResult result = MeasureLargeScene(generatorSettings);
+
+            AURORA_INFO(LogLayer::ECS, "World Benchmark (%u Generated Entities, Depth %u): Generate %.2fms, First Tick %.2fms, Tick %.2fms (peak %.2fms), Transform Update %.2fms, "
+                        "Cull %.2fms (%u visible), Churn Tick %.2fms (%u entities/tick), Save %.2fms, Destroy %.2fms, Load %.2fms%s%s.",
+                        entityCount, result.m_HierarchyDepth, result.m_GenerateMilliseconds, result.m_FirstTickMilliseconds, result.m_TickMilliseconds, result.m_PeakTickMilliseconds,
+                        result.m_TransformUpdateMilliseconds, result.m_CullMilliseconds, result.m_VisibleCount, result.m_ChurnTickMilliseconds, result.m_ChurnedEntitiesPerTick,
+                        result.m_SaveMilliseconds, result.m_DestroyMilliseconds, result.m_LoadMilliseconds, result.m_IsWorldValid ? "" : " - World Mismatch",
+                        result.m_IsHierarchyValid ? "" : " - Hierarchy Mismatch");
+
+            m_LargeSceneResults.push_back(result);
+        }
+
+        FileSystem::Delete(m_LargeScenePath);
+    }
+
+    void WorldBenchmark::RemoveEntitiesFrom(uint32_t firstEntityIndex)
+    {
+        // Entities we create sit past the scene's, and only ever parent one another. Removing them thus leaves the scene's where they were.
+        const std::vector<std::shared_ptr<Entity>>& entities = m_World->EntityGetAll();
+        for (size_t i = firstEntityIndex; i < entities.size(); i++)
+        {
+            m_World->EntityRemove(entities[i]);
+        }
+
+        m_World->ResolvePendingDestruction();
+    }
+
+    std::vector<std::shared_ptr<Entity>> WorldBenchmark::CreateEntityGroups(uint32_t entityCount)
+    {
+        std::vector<std::shared_ptr<Entity>> rootEntities;
+
+        for (uint32_t groupIndex = 0; groupIndex < entityCount / m_EntitiesPerGroup; groupIndex++)
+        {
+            std::shared_ptr<Entity> rootEntity = m_World->EntityCreate();
+            rootEntity->SetObjectID(m_NextEntityID++);
+            rootEntity->SetEntityName("Benchmark_Root");
+            rootEntity->GetTransform()->Translate(XMFLOAT3(static_cast<float>(groupIndex), 0.0f, 0.0f));
+
+            for (uint32_t childIndex = 1; childIndex < m_EntitiesPerGroup; childIndex++)
+            {
+                std::shared_ptr<Entity> childEntity = m_World->EntityCreate();
+                childEntity->SetObjectID(m_NextEntityID++);
+                childEntity->SetEntityName("Benchmark_Child");
+                childEntity->GetTransform()->Translate(XMFLOAT3(0.0f, static_cast<float>(childIndex), 0.0f));
+                childEntity->GetTransform()->SetParentTransform(rootEntity->GetTransform());
+            }
+
+            rootEntities.emplace_back(rootEntity);
+        }
+
+        return rootEntities;
+    }
+
+    WorldBenchmarkDeserializationResult WorldBenchmark::MeasureDeserialization(uint32_t entityCount)
+    {
+        WorldBenchmarkDeserializationResult result;
+        result.m_EntityCount = entityCount;
+
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        std::vector<std::shared_ptr<Entity>> rootEntities = CreateEntityGroups(entityCount);
+        result.m_CreateMilliseconds = ElapsedMilliseconds(startTime);
+
+        {
+            BinarySerializer binarySerializer(m_ScenePath, SerializerFlag::SerializerMode_Write);
+            if (!binarySerializer.IsStreamOpen())
+            {
+                AURORA_ERROR(LogLayer::ECS, "World Benchmark: Failed to open \"%s\" for writing.", m_ScenePath);
+                rootEntities.clear();
+                RemoveEntitiesFrom(firstEntityIndex);
+                return result;
+            }
+
+            startTime = BenchmarkClock::now();
+            m_World->SerializeRootEntities(&binarySerializer, rootEntities);
+            binarySerializer.CloseStream();
+            result.m_SerializeMilliseconds = ElapsedMilliseconds(startTime);
+        }
+
+        // Tear down what we serialized. The IDs are read back from the file, so the originals must be gone for lookups to find the new entities.
+        rootEntities.clear();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        {
+            BinarySerializer binaryDeserializer(m_ScenePath, SerializerFlag::SerializerMode_Read);
+
+            startTime = BenchmarkClock::now();
+            rootEntities = m_World->DeserializeRootEntities(&binaryDeserializer);
+            result.m_DeserializeMilliseconds = ElapsedMilliseconds(startTime);
+            result.m_DeserializeNanosecondsPerEntity = (result.m_DeserializeMilliseconds * 1e6) / entityCount;
+        }
+
+        // Every group should be back in full.
+        result.m_IsHierarchyValid = (m_World->EntityGetAll().size() - firstEntityIndex) == entityCount;
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            if (rootEntity->GetTransform()->HasParentTransform() || rootEntity->GetTransform()->GetChildrenCount() != m_EntitiesPerGroup - 1)
+            {
+                result.m_IsHierarchyValid = false;
+                break;
+            }
+        }
+
+        rootEntities.clear();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        return result;
+    }
+
+    WorldBenchmarkDestructionResult WorldBenchmark::MeasureDestruction(uint32_t entityCount)
+    {
+        WorldBenchmarkDestructionResult result;
+        result.m_EntityCount = entityCount;
+
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+        std::vector<std::shared_ptr<Entity>> rootEntities = CreateEntityGroups(entityCount);
+
+        // Queue every child, then resolve the batch as the end of a frame would.
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            for (Transform* childTransform : rootEntity->GetTransform()->GetChildren())
+            {
+                m_World->EntityRemove(childTransform->GetEntity()->GetPointerShared());
+            }
+        }
+        m_World->ResolvePendingDestruction();
+        result.m_DestroyChildrenMilliseconds = ElapsedMilliseconds(startTime);
+
+        result.m_IsWorldValid = (m_World->EntityGetAll().size() - firstEntityIndex) == rootEntities.size();
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            if (rootEntity->GetTransform()->HasChildren())
+            {
+                result.m_IsWorldValid = false;
+                break;
+            }
+        }
+
+        // Our references go first, so that the roots are destroyed within the batch rather than after it.
+        startTime = BenchmarkClock::now();
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            m_World->EntityRemove(rootEntity);
+        }
+        rootEntities.clear();
+        m_World->ResolvePendingDestruction();
+        result.m_DestroyRootsMilliseconds = ElapsedMilliseconds(startTime);
+
+        result.m_DestroyNanosecondsPerEntity = ((result.m_DestroyChildrenMilliseconds + result.m_DestroyRootsMilliseconds) * 1e6) / entityCount;
+        result.m_IsWorldValid = result.m_IsWorldValid && m_World->EntityGetAll().size() == firstEntityIndex;
+
+        RemoveEntitiesFrom(firstEntityIndex);
+        return result;
+    }
+
+    WorldBenchmarkInstantiationResult WorldBenchmark::MeasureInstantiation(uint32_t instanceCount)
+    {
+        WorldBenchmarkInstantiationResult result;
+        result.m_InstanceCount = instanceCount;
+
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+
+        // Build and save our crate.
+        Prefab cratePrefab(m_EngineContext);
+        {
+            std::shared_ptr<Entity> crateEntity = m_World->EntityCreate();
+            crateEntity->SetEntityName("Benchmark_Crate");
+
+            for (uint32_t childIndex = 0; childIndex < m_CrateChildCount; childIndex++)
+            {
+                std::shared_ptr<Entity> childEntity = m_World->EntityCreate();
+                childEntity->SetEntityName("Benchmark_Crate_Part");
+                childEntity->GetTransform()->Translate(XMFLOAT3(0.0f, static_cast<float>(childIndex + 1), 0.0f));
+                childEntity->GetTransform()->SetParentTransform(crateEntity->GetTransform());
+            }
+
+            cratePrefab.AppendToPrefab(crateEntity.get());
+            if (!cratePrefab.SaveToFile(m_PrefabPath))
+            {
+                RemoveEntitiesFrom(firstEntityIndex);
+                return result;
+            }
+        }
+
+        // The template is all we need from here on.
+        const PrefabTemplate crateTemplate = cratePrefab.GetTemplate();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        // Spawning by loading the file for every instance, as was the only way.
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        for (uint32_t i = 0; i < m_FileLoadInstanceCount; i++)
+        {
+            Prefab loadedPrefab(m_EngineContext);
+            loadedPrefab.LoadFromFile(m_PrefabPath);
+        }
+        result.m_FileLoadNanosecondsPerInstance = (ElapsedMilliseconds(startTime) * 1e6) / m_FileLoadInstanceCount;
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        // Spawning from memory, laid out on a grid.
+        std::vector<PrefabInstanceTransform> instanceTransforms(instanceCount);
+        for (uint32_t i = 0; i < instanceCount; i++)
+        {
+            instanceTransforms[i].m_Position = XMFLOAT3(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100));
+        }
+
+        startTime = BenchmarkClock::now();
+        std::vector<std::shared_ptr<Entity>> rootEntities = m_World->Instantiate(crateTemplate, instanceCount, instanceTransforms.data());
+        result.m_InstantiateMilliseconds = ElapsedMilliseconds(startTime);
+        result.m_InstantiateNanosecondsPerInstance = (result.m_InstantiateMilliseconds * 1e6) / instanceCount;
+
+        result.m_IsHierarchyValid = rootEntities.size() == instanceCount && (m_World->EntityGetAll().size() - firstEntityIndex) == instanceCount * (m_CrateChildCount + 1);
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            if (rootEntity->GetTransform()->HasParentTransform() || rootEntity->GetTransform()->GetChildrenCount() != m_CrateChildCount)
+            {
+                result.m_IsHierarchyValid = false;
+                break;
+            }
+        }
+
+        rootEntities.clear();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        return result;
+    }
+
+    WorldBenchmarkSpawnResult WorldBenchmark::MeasureSpawn(uint32_t entityCount)
+    {
+        WorldBenchmarkSpawnResult result;
+        result.m_EntityCount = entityCount;
+
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+
+        for (uint32_t round = 0; round < 2; round++)
+        {
+            const AllocationScope allocationScope;
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            for (uint32_t i = 0; i < entityCount; i++)
+            {
+                m_World->EntityCreate()->SetObjectID(m_NextEntityID++);
+            }
+            const double spawnMilliseconds = ElapsedMilliseconds(startTime);
+            const double allocationsPerEntity = static_cast<double>(allocationScope.GetAllocationCount()) / entityCount;
+
+            if (round == 0)
+            {
+                result.m_SpawnMilliseconds = spawnMilliseconds;
+                result.m_AllocationsPerEntity = allocationsPerEntity;
+            }
+            else
+            {
+                result.m_WarmSpawnMilliseconds = spawnMilliseconds;
+                result.m_WarmAllocationsPerEntity = allocationsPerEntity;
+            }
+
+            const BenchmarkClock::time_point despawnStartTime = BenchmarkClock::now();
+            RemoveEntitiesFrom(firstEntityIndex);
+            if (round == 0)
+            {
+                result.m_DespawnMilliseconds = ElapsedMilliseconds(despawnStartTime);
+            }
+        }
+
+        return result;
+    }
+
+    WorldBenchmarkSpatialQueryResult WorldBenchmark::MeasureSpatialQueries(uint32_t entityCount)
+    {
+        WorldBenchmarkSpatialQueryResult result;
+        result.m_EntityCount = entityCount;
+
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+        const float worldExtent = m_SpatialCellSize * std::cbrt(static_cast<float>(entityCount));
+
+        std::mt19937 randomEngine(entityCount);
+        std::uniform_real_distribution<float> randomPosition(0.0f, worldExtent);
+        auto randomPoint = [&]() { return Vector3(randomPosition(randomEngine), randomPosition(randomEngine), randomPosition(randomEngine)); };
+
+        std::vector<Entity*> entities;
+        for (uint32_t i = 0; i < entityCount; i++)
+        {
+            std::shared_ptr<Entity> entity = m_World->EntityCreate();
+            entity->SetObjectID(m_NextEntityID++);
+            const Vector3 position = randomPoint();
+            entity->GetTransform()->Translate(XMFLOAT3(position.x, position.y, position.z));
+            entities.push_back(entity.get());
+        }
+
+        // Place our entities before they are indexed, so that every proxy is inserted where it stays.
+        m_World->UpdateTransforms(nullptr);
+
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        for (Entity* entity : entities)
+        {
+            entity->AddComponent<Renderable>();
+        }
+        result.m_InsertMilliseconds = ElapsedMilliseconds(startTime);
+
+        // A tenth of our entities move, half of them beyond their fat bounds.
+        for (uint32_t i = 0; i < entityCount; i += 10)
+        {
+            entities[i]->GetTransform()->Translate(XMFLOAT3(0.0f, (i % 20 == 0) ? 1.0f : 0.01f, 0.0f));
+        }
+
+        startTime = BenchmarkClock::now();
+        m_World->UpdateTransforms(nullptr);
+        result.m_RefitMilliseconds = ElapsedMilliseconds(startTime);
+        result.m_TreeHeight = m_World->GetSpatialIndex().GetHeight();
+
+        // Queries are generated up front, so that the indexed and linear passes see the same ones.
+        std::vector<BoundingBox> queryBoxes;
+        std::vector<Ray> queryRays;
+        for (uint32_t i = 0; i < m_SpatialQueryCount; i++)
+        {
+            const Vector3 boxCenter = randomPoint();
+            queryBoxes.emplace_back(boxCenter - Vector3(m_SpatialCellSize), boxCenter + Vector3(m_SpatialCellSize));
+            queryRays.emplace_back(randomPoint(), randomPoint());
+        }
+
+        std::vector<Entity*> queryResults;
+        startTime = BenchmarkClock::now();
+        for (const BoundingBox& queryBox : queryBoxes)
+        {
+            queryResults.clear();
+            m_World->QueryEntitiesInBox(queryBox, &queryResults);
+        }
+        result.m_BoxQueryNanoseconds = ElapsedMilliseconds(startTime) * 1000000.0 / m_SpatialQueryCount;
+
+        startTime = BenchmarkClock::now();
+        for (const Ray& queryRay : queryRays)
+        {
+            m_World->QueryClosestEntityOnRay(queryRay);
+        }
+        result.m_RayQueryNanoseconds = ElapsedMilliseconds(startTime) * 1000000.0 / m_SpatialQueryCount;
+
+        // Linear passes, as culling and picking went before the index.
+        const std::vector<Entity*>& renderableEntities = m_World->GetEntitiesByComponent(ComponentType::Renderable);
+        auto linearBoxQuery = [&renderableEntities](const BoundingBox& queryBox, std::vector<Entity*>* entities)
+        {
+            for (Entity* entity : renderableEntities)
+            {
+                if (queryBox.IsInside(entity->GetComponent<Renderable>()->GetWorldBounds()) != Intersection::Outside)
+                {
+                    entities->push_back(entity);
+                }
+            }
+        };
+
+        auto linearRayQuery = [&renderableEntities](const Ray& queryRay)
+        {
+            float closestDistance = Helper::Infinity;
+            for (Entity* entity : renderableEntities)
+            {
+                const float distance = queryRay.HitDistance(entity->GetComponent<Renderable>()->GetWorldBounds());
+                if (distance < closestDistance && distance <= queryRay.GetLength())
+                {
+                    closestDistance = distance;
+                }
+            }
+
+            return closestDistance;
+        };
+
+        startTime = BenchmarkClock::now();
+        for (uint32_t i = 0; i < m_LinearQueryCount; i++)
+        {
+            queryResults.clear();
+            linearBoxQuery(queryBoxes[i], &queryResults);
+        }
+        result.m_LinearBoxQueryNanoseconds = ElapsedMilliseconds(startTime) * 1000000.0 / m_LinearQueryCount;
+
+        startTime = BenchmarkClock::now();
+        for (uint32_t i = 0; i < m_LinearQueryCount; i++)
+        {
+            linearRayQuery(queryRays[i]);
+        }
+        result.m_LinearRayQueryNanoseconds = ElapsedMilliseconds(startTime) * 1000000.0 / m_LinearQueryCount;
+
+        // Fat proxies may return a few entities just outside a box, but never miss one inside it. Closest hits are tested against exact bounds, so their distances should
+        // agree (entities may tie, such as when a ray starts inside several).
+        std::vector<Entity*> linearResults;
+        result.m_AreResultsValid = true;
+        for (uint32_t i = 0; i < m_LinearQueryCount && result.m_AreResultsValid; i++)
+        {
+            queryResults.clear();
+            linearResults.clear();
+            m_World->QueryEntitiesInBox(queryBoxes[i], &queryResults);
+            linearBoxQuery(queryBoxes[i], &linearResults);
+
+            std::sort(queryResults.begin(), queryResults.end());
+            std::sort(linearResults.begin(), linearResults.end());
+            float hitDistance = 0.0f;
+            m_World->QueryClosestEntityOnRay(queryRays[i], &hitDistance);
+            result.m_AreResultsValid = std::includes(queryResults.begin(), queryResults.end(), linearResults.begin(), linearResults.end()) && hitDistance == linearRayQuery(queryRays[i]);
+        }
+
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        return result;
+    }
+
+    WorldBenchmarkStreamingResult WorldBenchmark::MeasureStreaming(uint32_t entityCount)
+    {
+        WorldBenchmarkStreamingResult result;
+        result.m_EntityCount = entityCount;
+
+        WorldStreamer* worldStreamer = m_World->GetStreamer();
+        const bool wasStreaming = worldStreamer->IsEnabled();
+        worldStreamer->Disable();
+        FileSystem::Delete(m_CellDirectory);
+
+        WorldStreamingSettings streamingSettings;
+        streamingSettings.m_CellDirectory = m_CellDirectory;
+        const float gridExtent = streamingSettings.m_CellSize * m_StreamingGridSize;
+        streamingSettings.m_LoadDistance = gridExtent;  // From the grid's center, reaching every cell.
+        streamingSettings.m_UnloadDistance = gridExtent * 2.0f;
+
+        // Scatter our groups over the grid.
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+        std::vector<std::shared_ptr<Entity>> rootEntities = CreateEntityGroups(entityCount);
+
+        std::mt19937 randomEngine(entityCount);
+        std::uniform_real_distribution<float> randomPosition(0.0f, gridExtent);
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            rootEntity->GetTransform()->Translate(XMFLOAT3(randomPosition(randomEngine), 0.0f, randomPosition(randomEngine)));
+        }
+        m_World->UpdateTransforms(nullptr);
+
+        worldStreamer->Enable(streamingSettings);
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        worldStreamer->SaveCells(rootEntities);
+        result.m_SaveMilliseconds = ElapsedMilliseconds(startTime);
+
+        rootEntities.clear();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        // Stream everything back in, updating as ticks would. Updates which link nothing are waiting on the disk.
+        const XMFLOAT3 gridCenter(gridExtent * 0.5f, 0.0f, gridExtent * 0.5f);
+        startTime = BenchmarkClock::now();
+        do
+        {
+            worldStreamer->Update(gridCenter);
+            result.m_UpdateCount++;
+            if (worldStreamer->GetStatistics().m_RootsLinkedLastUpdate == 0)
+            {
+                std::this_thread::yield();
+            }
+        } while (!worldStreamer->IsIdle());
+        result.m_StreamInMilliseconds = ElapsedMilliseconds(startTime);
+
+        result.m_CellCount = worldStreamer->GetStatistics().m_CellsLoaded;
+        result.m_FrameBudgetMilliseconds = streamingSettings.m_FrameBudgetMilliseconds;
+        result.m_PeakLinkMilliseconds = worldStreamer->GetStatistics().m_LinkMillisecondsPeak;
+        result.m_IsWorldValid = (m_World->EntityGetAll().size() - firstEntityIndex) == entityCount;
+
+        // Moving far away unloads every cell.
+        startTime = BenchmarkClock::now();
+        worldStreamer->Update(XMFLOAT3(gridExtent * 100.0f, 0.0f, gridExtent * 100.0f));
+        m_World->ResolvePendingDestruction();
+        result.m_UnloadMilliseconds = ElapsedMilliseconds(startTime);
+        result.m_IsWorldValid = result.m_IsWorldValid && m_World->EntityGetAll().size() == firstEntityIndex;
+
+        worldStreamer->Disable();
+        if (wasStreaming)
+        {
+            AURORA_WARNING(LogLayer::ECS, "World streaming was disabled to run the benchmark, and must be enabled again.");
+        }
+
+        return result;
+    }
+
+    WorldBenchmarkLargeSceneResult WorldBenchmark::MeasureLargeScene(const SceneGeneratorSettings& sceneSettings)
+    {
+        WorldBenchmarkLargeSceneResult result;
+        result.m_EntityCount = sceneSettings.m_EntityCount;
+        result.m_HierarchyDepth = sceneSettings.m_HierarchyDepth;
+
+        Threading* threading = m_EngineContext->GetSubsystem<Threading>();
+        const uint32_t firstEntityIndex = static_cast<uint32_t>(m_World->EntityGetAll().size());
+
+        // Components are counted against those the scene already holds.
+        const uint32_t sceneRenderableCount = static_cast<uint32_t>(m_World->GetComponentStorage<Renderable>().GetComponents().size());
+        const uint32_t sceneLightCount = static_cast<uint32_t>(m_World->GetComponentStorage<Light>().GetComponents().size());
+        const uint32_t sceneRigidBodyCount = static_cast<uint32_t>(m_World->GetComponentStorage<RigidBody>().GetComponents().size());
+        const uint32_t sceneScriptCount = static_cast<uint32_t>(m_World->GetComponentStorage<Script>().GetComponents().size());
+
+        SceneGenerator sceneGenerator(m_World, sceneSettings);
+        BenchmarkClock::time_point startTime = BenchmarkClock::now();
+        sceneGenerator.Generate();
+        result.m_GenerateMilliseconds = ElapsedMilliseconds(startTime);
+        m_NextEntityID = sceneGenerator.GetNextEntityID();
+
+        result.m_RenderableCount = static_cast<uint32_t>(m_World->GetComponentStorage<Renderable>().GetComponents().size()) - sceneRenderableCount;
+        result.m_LightCount = static_cast<uint32_t>(m_World->GetComponentStorage<Light>().GetComponents().size()) - sceneLightCount;
+        result.m_RigidBodyCount = static_cast<uint32_t>(m_World->GetComponentStorage<RigidBody>().GetComponents().size()) - sceneRigidBodyCount;
+        result.m_ScriptCount = static_cast<uint32_t>(m_World->GetComponentStorage<Script>().GetComponents().size()) - sceneScriptCount;
+        result.m_IsWorldValid = (m_World->EntityGetAll().size() - firstEntityIndex) == sceneSettings.m_EntityCount;
+
+        // Every transform starts out dirty, hence the first tick updates all of them.
+        startTime = BenchmarkClock::now();
+        m_World->Tick(m_LargeSceneDeltaTime);
+        result.m_FirstTickMilliseconds = ElapsedMilliseconds(startTime);
+
+        for (uint32_t i = 0; i < m_LargeSceneTickCount; i++)
+        {
+            sceneGenerator.MoveRoots();
+
+            startTime = BenchmarkClock::now();
+            m_World->Tick(m_LargeSceneDeltaTime);
+            const double tickMilliseconds = ElapsedMilliseconds(startTime);
+
+            result.m_TickMilliseconds += tickMilliseconds / m_LargeSceneTickCount;
+            result.m_PeakTickMilliseconds = std::max(result.m_PeakTickMilliseconds, tickMilliseconds);
+        }
+
+        // The transform update within a tick, on its own.
+        for (uint32_t i = 0; i < m_LargeSceneTickCount; i++)
+        {
+            sceneGenerator.MoveRoots();
+
+            startTime = BenchmarkClock::now();
+            m_World->UpdateTransforms(threading);
+            result.m_TransformUpdateMilliseconds += ElapsedMilliseconds(startTime) / m_LargeSceneTickCount;
+        }
+
+        // Culling as the renderer does every frame, from wherever the camera is looking.
+        if (m_World->m_CameraPointer)
+        {
+            const Camera* camera = m_World->m_CameraPointer->GetComponent<Camera>();
+            const XMMATRIX viewProjectionMatrix = camera->GetViewMatrix() * camera->GetProjectionMatrix();
+
+            std::vector<Entity*> visibleEntities;
+            startTime = BenchmarkClock::now();
+            for (uint32_t i = 0; i < m_LargeSceneTickCount; i++)
+            {
+                visibleEntities.clear();
+                m_World->QueryEntitiesInFrustum(viewProjectionMatrix, &visibleEntities);
+            }
+            result.m_CullMilliseconds = ElapsedMilliseconds(startTime) / m_LargeSceneTickCount;
+            result.m_VisibleCount = static_cast<uint32_t>(visibleEntities.size());
+        }
+
+        uint32_t churnedEntityCount = 0;
+        for (uint32_t i = 0; i < m_LargeSceneTickCount; i++)
+        {
+            startTime = BenchmarkClock::now();
+            sceneGenerator.Churn();
+            m_World->Tick(m_LargeSceneDeltaTime);
+            result.m_ChurnTickMilliseconds += ElapsedMilliseconds(startTime) / m_LargeSceneTickCount;
+            churnedEntityCount += sceneGenerator.GetChurnedEntitiesLastCall();
+        }
+        m_NextEntityID = sceneGenerator.GetNextEntityID();
+        result.m_ChurnedEntitiesPerTick = churnedEntityCount / m_LargeSceneTickCount;
+        result.m_IsWorldValid = result.m_IsWorldValid && (m_World->EntityGetAll().size() - firstEntityIndex) == sceneSettings.m_EntityCount;
+
+        {
+            BinarySerializer binarySerializer(m_LargeScenePath, SerializerFlag::SerializerMode_Write);
+            if (!binarySerializer.IsStreamOpen())
+            {
+                AURORA_ERROR(LogLayer::ECS, "World Benchmark: Failed to open \"%s\" for writing.", m_LargeScenePath);
+                RemoveEntitiesFrom(firstEntityIndex);
+                result.m_IsWorldValid = false;
+                return result;
+            }
+
+            startTime = BenchmarkClock::now();
+            m_World->SerializeRootEntities(&binarySerializer, sceneGenerator.GetRootEntities());
+            binarySerializer.CloseStream();
+            result.m_SaveMilliseconds = ElapsedMilliseconds(startTime);
+        }
+
+        // Needed to check what we load against, and forgotten by the generator upon removal.
+        const std::vector<uint32_t> hierarchySizes = sceneGenerator.GetHierarchySizes();
+
+        startTime = BenchmarkClock::now();
+        sceneGenerator.Remove();
+        m_World->ResolvePendingDestruction();
+        result.m_DestroyMilliseconds = ElapsedMilliseconds(startTime);
+        result.m_IsWorldValid = result.m_IsWorldValid && m_World->EntityGetAll().size() == firstEntityIndex;
+
+        std::vector<std::shared_ptr<Entity>> rootEntities;
+        {
+            BinarySerializer binaryDeserializer(m_LargeScenePath, SerializerFlag::SerializerMode_Read);
+
+            startTime = BenchmarkClock::now();
+            rootEntities = m_World->DeserializeRootEntities(&binaryDeserializer);
+            result.m_LoadMilliseconds = ElapsedMilliseconds(startTime);
+        }
+
+        result.m_IsWorldValid = result.m_IsWorldValid && (m_World->EntityGetAll().size() - firstEntityIndex) == sceneSettings.m_EntityCount;
+
+        // Every hierarchy should be back in the order saved, shaped as generated. Levels are walked as the generator fills them, each parent having as many children as
+        // were left to create (up to our branching), with every child under its parent.
+        const uint32_t hierarchyDepth = sceneGenerator.GetSettings().m_HierarchyDepth;
+        const uint32_t childrenPerEntity = sceneGenerator.GetSettings().m_ChildrenPerEntity;
+        result.m_IsHierarchyValid = rootEntities.size() == hierarchySizes.size();
+
+        std::vector<Transform*> levelTransforms;
+        std::vector<Transform*> childLevelTransforms;
+        for (size_t rootIndex = 0; rootIndex < rootEntities.size() && result.m_IsHierarchyValid; rootIndex++)
+        {
+            const uint32_t hierarchySize = hierarchySizes[rootIndex];
+            uint32_t entityCount = 1;
+            levelTransforms.assign(1, rootEntities[rootIndex]->GetTransform());
+            result.m_IsHierarchyValid = !rootEntities[rootIndex]->GetTransform()->HasParentTransform();
+
+            for (uint32_t level = 0; !levelTransforms.empty() && result.m_IsHierarchyValid; level++)
+            {
+                childLevelTransforms.clear();
+                for (Transform* transform : levelTransforms)
+                {
+                    const uint32_t expectedChildCount = level + 1 < hierarchyDepth ? std::min(childrenPerEntity, hierarchySize - entityCount) : 0;
+                    if (transform->GetChildrenCount() != expectedChildCount)
+                    {
+                        result.m_IsHierarchyValid = false;
+                        break;
+                    }
+
+                    for (Transform* childTransform : transform->GetChildren())
+                    {
+                        result.m_IsHierarchyValid = result.m_IsHierarchyValid && childTransform->GetParentTransform() == transform;
+                        childLevelTransforms.push_back(childTransform);
+                    }
+                    entityCount += expectedChildCount;
+                }
+
+                std::swap(levelTransforms, childLevelTransforms);
+            }
+
+            result.m_IsHierarchyValid = result.m_IsHierarchyValid && entityCount == hierarchySize;
+        }
+
+        rootEntities.clear();
+        RemoveEntitiesFrom(firstEntityIndex);
+
+        return result;
+    }
+
+    bool WorldBenchmark::WriteJson(const std::string& filePath) const
+    {
+        std::ofstream outputStream(filePath);
+        if (!outputStream.is_open())
+        {
+            AURORA_ERROR(LogLayer::ECS, "Failed to open \"%s\" for writing world benchmark results.", filePath.c_str());
+            return false;
+        }
+
+        outputStream << std::fixed << std::setprecision(3);
+        outputStream << "{\n";
+        outputStream << "  \"entities_per_group\": " << m_EntitiesPerGroup << ",\n";
+        outputStream << "  \"deserialization\": [\n";
+
+        for (size_t i = 0; i < m_DeserializationResults.size(); i++)
+        {
+            const WorldBenchmarkDeserializationResult& result = m_DeserializationResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"create_ms\": " << result.m_CreateMilliseconds << ",\n";
+            outputStream << "      \"serialize_ms\": " << result.m_SerializeMilliseconds << ",\n";
+            outputStream << "      \"deserialize_ms\": " << result.m_DeserializeMilliseconds << ",\n";
+            outputStream << "      \"deserialize_ns_per_entity\": " << result.m_DeserializeNanosecondsPerEntity << ",\n";
+            outputStream << "      \"deserialize_scaling\": " << result.m_DeserializeScaling << ",\n";
+            outputStream << "      \"hierarchy_valid\": " << (result.m_IsHierarchyValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_DeserializationResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"destruction\": [\n";
+
+        for (size_t i = 0; i < m_DestructionResults.size(); i++)
+        {
+            const WorldBenchmarkDestructionResult& result = m_DestructionResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"destroy_children_ms\": " << result.m_DestroyChildrenMilliseconds << ",\n";
+            outputStream << "      \"destroy_roots_ms\": " << result.m_DestroyRootsMilliseconds << ",\n";
+            outputStream << "      \"destroy_ns_per_entity\": " << result.m_DestroyNanosecondsPerEntity << ",\n";
+            outputStream << "      \"destroy_scaling\": " << result.m_DestroyScaling << ",\n";
+            outputStream << "      \"world_valid\": " << (result.m_IsWorldValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_DestructionResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"instantiation\": [\n";
+
+        for (size_t i = 0; i < m_InstantiationResults.size(); i++)
+        {
+            const WorldBenchmarkInstantiationResult& result = m_InstantiationResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"instances\": " << result.m_InstanceCount << ",\n";
+            outputStream << "      \"instantiate_ms\": " << result.m_InstantiateMilliseconds << ",\n";
+            outputStream << "      \"instantiate_ns_per_instance\": " << result.m_InstantiateNanosecondsPerInstance << ",\n";
+            outputStream << "      \"file_load_ns_per_instance\": " << result.m_FileLoadNanosecondsPerInstance << ",\n";
+            outputStream << "      \"hierarchy_valid\": " << (result.m_IsHierarchyValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_InstantiationResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"spawn\": [\n";
+
+        for (size_t i = 0; i < m_SpawnResults.size(); i++)
+        {
+            const WorldBenchmarkSpawnResult& result = m_SpawnResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"spawn_ms\": " << result.m_SpawnMilliseconds << ",\n";
+            outputStream << "      \"despawn_ms\": " << result.m_DespawnMilliseconds << ",\n";
+            outputStream << "      \"warm_spawn_ms\": " << result.m_WarmSpawnMilliseconds << ",\n";
+            if (AllocationTracker::IsTracking())
+            {
+                outputStream << "      \"allocations_per_entity\": " << result.m_AllocationsPerEntity << ",\n";
+                outputStream << "      \"warm_allocations_per_entity\": " << result.m_WarmAllocationsPerEntity << "\n";
+            }
+            else
+            {
+                outputStream << "      \"allocations_per_entity\": null,\n";
+                outputStream << "      \"warm_allocations_per_entity\": null\n";
+            }
+            outputStream << "    }" << (i + 1 < m_SpawnResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"spatial_queries\": [\n";
+
+        for (size_t i = 0; i < m_SpatialQueryResults.size(); i++)
+        {
+            const WorldBenchmarkSpatialQueryResult& result = m_SpatialQueryResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"insert_ms\": " << result.m_InsertMilliseconds << ",\n";
+            outputStream << "      \"refit_ms\": " << result.m_RefitMilliseconds << ",\n";
+            outputStream << "      \"box_query_ns\": " << result.m_BoxQueryNanoseconds << ",\n";
+            outputStream << "      \"linear_box_query_ns\": " << result.m_LinearBoxQueryNanoseconds << ",\n";
+            outputStream << "      \"ray_query_ns\": " << result.m_RayQueryNanoseconds << ",\n";
+            outputStream << "      \"linear_ray_query_ns\": " << result.m_LinearRayQueryNanoseconds << ",\n";
+            outputStream << "      \"tree_height\": " << result.m_TreeHeight << ",\n";
+            outputStream << "      \"results_valid\": " << (result.m_AreResultsValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_SpatialQueryResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"streaming\": [\n";
+
+        for (size_t i = 0; i < m_StreamingResults.size(); i++)
+        {
+            const WorldBenchmarkStreamingResult& result = m_StreamingResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"cells\": " << result.m_CellCount << ",\n";
+            outputStream << "      \"save_ms\": " << result.m_SaveMilliseconds << ",\n";
+            outputStream << "      \"stream_in_ms\": " << result.m_StreamInMilliseconds << ",\n";
+            outputStream << "      \"updates\": " << result.m_UpdateCount << ",\n";
+            outputStream << "      \"frame_budget_ms\": " << result.m_FrameBudgetMilliseconds << ",\n";
+            outputStream << "      \"peak_link_ms\": " << result.m_PeakLinkMilliseconds << ",\n";
+            outputStream << "      \"unload_ms\": " << result.m_UnloadMilliseconds << ",\n";
+            outputStream << "      \"world_valid\": " << (result.m_IsWorldValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_StreamingResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ],\n";
+        outputStream << "  \"large_scene_settings\": {\n";
+        outputStream << "    \"children_per_entity\": " << m_LargeSceneSettings.m_ChildrenPerEntity << ",\n";
+        outputStream << "    \"renderable_ratio\": " << m_LargeSceneSettings.m_RenderableRatio << ",\n";
+        outputStream << "    \"light_ratio\": " << m_LargeSceneSettings.m_LightRatio << ",\n";
+        outputStream << "    \"rigid_body_ratio\": " << m_LargeSceneSettings.m_RigidBodyRatio << ",\n";
+        outputStream << "    \"script_ratio\": " << m_LargeSceneSettings.m_ScriptRatio << ",\n";
+        outputStream << "    \"move_ratio\": " << m_LargeSceneSettings.m_MoveRatio << ",\n";
+        outputStream << "    \"churn_ratio\": " << m_LargeSceneSettings.m_ChurnRatio << ",\n";
+        outputStream << "    \"seed\": " << m_LargeSceneSettings.m_Seed << ",\n";
+        outputStream << "    \"ticks\": " << m_LargeSceneTickCount << "\n";
+        outputStream << "  },\n";
+        outputStream << "  \"large_scene\": [\n";
+
+        for (size_t i = 0; i < m_LargeSceneResults.size(); i++)
+        {
+            const WorldBenchmarkLargeSceneResult& result = m_LargeSceneResults[i];
+            outputStream << "    {\n";
+            outputStream << "      \"entities\": " << result.m_EntityCount << ",\n";
+            outputStream << "      \"hierarchy_depth\": " << result.m_HierarchyDepth << ",\n";
+            outputStream << "      \"renderables\": " << result.m_RenderableCount << ",\n";
+            outputStream << "      \"lights\": " << result.m_LightCount << ",\n";
+            outputStream << "      \"rigid_bodies\": " << result.m_RigidBodyCount << ",\n";
+            outputStream << "      \"scripts\": " << result.m_ScriptCount << ",\n";
+            outputStream << "      \"generate_ms\": " << result.m_GenerateMilliseconds << ",\n";
+            outputStream << "      \"first_tick_ms\": " << result.m_FirstTickMilliseconds << ",\n";
+            outputStream << "      \"tick_ms\": " << result.m_TickMilliseconds << ",\n";
+            outputStream << "      \"peak_tick_ms\": " << result.m_PeakTickMilliseconds << ",\n";
+            outputStream << "      \"transform_update_ms\": " << result.m_TransformUpdateMilliseconds << ",\n";
+            outputStream << "      \"cull_ms\": " << result.m_CullMilliseconds << ",\n";
+            outputStream << "      \"visible\": " << result.m_VisibleCount << ",\n";
+            outputStream << "      \"churn_tick_ms\": " << result.m_ChurnTickMilliseconds << ",\n";
+            outputStream << "      \"churned_entities_per_tick\": " << result.m_ChurnedEntitiesPerTick << ",\n";
+            outputStream << "      \"save_ms\": " << result.m_SaveMilliseconds << ",\n";
+            outputStream << "      \"destroy_ms\": " << result.m_DestroyMilliseconds << ",\n";
+            outputStream << "      \"load_ms\": " << result.m_LoadMilliseconds << ",\n";
+            outputStream << "      \"world_valid\": " << (result.m_IsWorldValid ? "true" : "false") << ",\n";
+            outputStream << "      \"hierarchy_valid\": " << (result.m_IsHierarchyValid ? "true" : "false") << "\n";
+            outputStream << "    }" << (i + 1 < m_LargeSceneResults.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ]\n";
+        outputStream << "}\n";
+
+        AURORA_INFO(LogLayer::ECS, "World benchmark results written to \"%s\".", filePath.c_str());
+        return true;
+    }
+}
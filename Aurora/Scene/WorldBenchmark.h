@@ -0,0 +1,201 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SceneGenerator.h"
+
+/* == World Benchmark ==
+
+    Measures how the World's CPU paths scale with entity count, so that anything quadratic shows up as numbers. Every measurement builds its entities inside the live World,
+    appended after whatever the scene already holds, and removes them again once done. The editor is blocked meanwhile.
+
+    - Deserialization: A synthetic scene of 10 entity groups (a root and 9 children) is serialized, torn down and deserialized again. Children resolve their parents by ID
+      as they are read, which once scanned every entity in the world and made loading O(n^2). The cost per entity should stay flat across entity counts.
+    - Bulk Destruction: Entity groups are destroyed through World::EntityRemove, first every child (leaving each root to forget its children) and then every root. Removal
+      once searched and erased from the entity list per entity, and had each parent rescan the world for its remaining children. The cost per entity should stay flat.
+    - Prefab Instantiation: A crate (a root and 2 children) is saved as a prefab, then spawned both by loading the prefab file per instance and through World::Instantiate
+      from its in-memory template with a transform per instance. The latter should cost a small fraction of the former per instance.
+    - Spawn/Despawn: Flat entities are created and removed twice over, counting heap allocations on the calling thread in builds defining AURORA_TRACK_ALLOCATIONS. The
+      second (warm) round draws entities from the World's block pools as left by the first, and should allocate little beyond the few containers each entity owns.
+    - Spatial Queries: Renderable entities are scattered through a cube whose volume grows with their count, keeping their density constant. Box and ray queries are timed
+      through the World's spatial index and against a linear pass over every renderable, as culling and picking did before. Indexed queries should cost close to the same
+      regardless of entity count, while the linear pass grows with it. Refitting after a tenth of the entities moved is timed as well.
+    - Cell Streaming: Entity groups are scattered over a grid of cells, saved as cell files and removed. The World Streamer then streams every cell back in around a focus
+      at the grid's center, with the time spent linking per update measured against its frame budget. Peaks may only exceed the budget by a single entity group. The
+      cells are then unloaded again by moving the focus away.
+
+    Large scenes are measured apart through RunLargeScenes(), as a million entities take far longer to build than the above. Each scene is built by the Scene Generator
+    (see SceneGenerator.h) with the given hierarchy depth, component mix and churn, then:
+
+    - Ticked: World::Tick is timed over a number of frames with a share of roots moving, alongside the transform update and refit on their own, and culling against
+      the camera's frustum as the renderer does every frame.
+    - Churned: Hierarchies are removed and generated anew ahead of every tick, which resolves their destruction.
+    - Saved, Destroyed and Loaded: Every generated hierarchy is written to a scene file, destroyed in a single batch, and read back in.
+
+    Results are logged and written out as JSON. The editor runs both from its threading widget, with large scenes of up to 100k entities. Passing -world_benchmark to the
+    demo instead runs every measurement (large scenes of 10k, 100k and 1M entities included) without the editor, writes the results and exits. See Demo.cpp for options.
+    Either way, the engine initializes in full, window and graphics device included, hence a display and GPU are required.
+*/
+
+namespace Aurora
+{
+    class EngineContext;
+    class World;
+    class Entity;
+
+    struct WorldBenchmarkDeserializationResult
+    {
+        uint32_t m_EntityCount = 0;
+
+        double m_CreateMilliseconds = 0.0;
+        double m_SerializeMilliseconds = 0.0;
+        double m_DeserializeMilliseconds = 0.0;
+        double m_DeserializeNanosecondsPerEntity = 0.0;
+        double m_DeserializeScaling = 1.0;             // Cost per entity relative to our smallest run. Stays near 1 when linear, grows with the entity count when quadratic.
+        bool m_IsHierarchyValid = false;               // Whether every entity made it back, with every child under its parent.
+    };
+
+    struct WorldBenchmarkDestructionResult
+    {
+        uint32_t m_EntityCount = 0;
+
+        double m_DestroyChildrenMilliseconds = 0.0;
+        double m_DestroyRootsMilliseconds = 0.0;
+        double m_DestroyNanosecondsPerEntity = 0.0;
+        double m_DestroyScaling = 1.0; // As with deserialization.
+        bool m_IsWorldValid = false;   // Whether roots were left without children, and every entity was removed in the end.
+    };
+
+    struct WorldBenchmarkInstantiationResult
+    {
+        uint32_t m_InstanceCount = 0;
+
+        double m_InstantiateMilliseconds = 0.0;
+        double m_InstantiateNanosecondsPerInstance = 0.0;
+        double m_FileLoadNanosecondsPerInstance = 0.0; // Loading the prefab file anew for each instance, over a smaller number of instances.
+        bool m_IsHierarchyValid = false;               // Whether every instance came with its children.
+    };
+
+    struct WorldBenchmarkSpawnResult
+    {
+        uint32_t m_EntityCount = 0;
+
+        double m_SpawnMilliseconds = 0.0;
+        double m_DespawnMilliseconds = 0.0;
+        double m_WarmSpawnMilliseconds = 0.0;
+        double m_AllocationsPerEntity = 0.0;     // Heap allocations per spawned entity, on our first round.
+        double m_WarmAllocationsPerEntity = 0.0; // As above, once our pools are warm.
+    };
+
+    struct WorldBenchmarkSpatialQueryResult
+    {
+        uint32_t m_EntityCount = 0;
+
+        double m_InsertMilliseconds = 0.0;             // Adding a renderable to every entity, each inserting a proxy into the index.
+        double m_RefitMilliseconds = 0.0;              // Updating transforms and refitting proxies after a tenth of our entities moved.
+        double m_BoxQueryNanoseconds = 0.0;            // Per query.
+        double m_LinearBoxQueryNanoseconds = 0.0;      // As above, testing every renderable's bounds.
+        double m_RayQueryNanoseconds = 0.0;            // Per closest hit query.
+        double m_LinearRayQueryNanoseconds = 0.0;
+        uint32_t m_TreeHeight = 0;
+        bool m_AreResultsValid = false;                // Whether indexed and linear box queries agreed on every entity found.
+    };
+
+    struct WorldBenchmarkStreamingResult
+    {
+        uint32_t m_EntityCount = 0;
+        uint32_t m_CellCount = 0;
+
+        double m_SaveMilliseconds = 0.0;
+        double m_StreamInMilliseconds = 0.0;      // Wall time until every cell was read and linked.
+        uint32_t m_UpdateCount = 0;               // Streamer updates taken to do so, as ticks would.
+        double m_FrameBudgetMilliseconds = 0.0;
+        double m_PeakLinkMilliseconds = 0.0;      // The most any single update spent linking.
+        double m_UnloadMilliseconds = 0.0;        // Queueing every cell's roots for destruction and resolving it.
+        bool m_IsWorldValid = false;              // Whether every entity streamed in, and was removed again upon unloading.
+    };
+
+    struct WorldBenchmarkLargeSceneResult
+    {
+        uint32_t m_EntityCount = 0;
+        uint32_t m_HierarchyDepth = 0;
+        uint32_t m_RenderableCount = 0;
+        uint32_t m_LightCount = 0;
+        uint32_t m_RigidBodyCount = 0;
+        uint32_t m_ScriptCount = 0;
+
+        double m_GenerateMilliseconds = 0.0;        // Creating every entity alongside its components.
+        double m_FirstTickMilliseconds = 0.0;       // Placing every entity and refitting its bounds for the first time.
+        double m_TickMilliseconds = 0.0;            // Mean World::Tick, with a share of roots moved ahead of each.
+        double m_PeakTickMilliseconds = 0.0;
+        double m_TransformUpdateMilliseconds = 0.0; // Mean transform hierarchy update and refit alone, after the same share of roots moved.
+        double m_CullMilliseconds = 0.0;            // Mean frustum query from the camera.
+        uint32_t m_VisibleCount = 0;
+        double m_ChurnTickMilliseconds = 0.0;       // Mean churn followed by World::Tick, which resolves the removed hierarchies.
+        uint32_t m_ChurnedEntitiesPerTick = 0;
+        double m_SaveMilliseconds = 0.0;
+        double m_DestroyMilliseconds = 0.0;         // Removing every hierarchy and resolving the batch.
+        double m_LoadMilliseconds = 0.0;
+        bool m_IsWorldValid = false;                // Whether the entity count held through churn, and every entity was loaded back.
+        bool m_IsHierarchyValid = false;            // Whether every loaded hierarchy came back as saved, with every child under its parent.
+    };
+
+    class WorldBenchmark
+    {
+    public:
+        WorldBenchmark(EngineContext* engineContext);
+
+        void Run();
+        void RunLargeScenes(const std::vector<uint32_t>& entityCounts, const SceneGeneratorSettings& sceneSettings = SceneGeneratorSettings()); // Entity counts override the settings'.
+        bool WriteJson(const std::string& filePath) const;
+
+        const std::vector<WorldBenchmarkDeserializationResult>& GetDeserializationResults() const { return m_DeserializationResults; }
+        const std::vector<WorldBenchmarkDestructionResult>& GetDestructionResults() const { return m_DestructionResults; }
+        const std::vector<WorldBenchmarkInstantiationResult>& GetInstantiationResults() const { return m_InstantiationResults; }
+        const std::vector<WorldBenchmarkSpawnResult>& GetSpawnResults() const { return m_SpawnResults; }
+        const std::vector<WorldBenchmarkSpatialQueryResult>& GetSpatialQueryResults() const { return m_SpatialQueryResults; }
+        const std::vector<WorldBenchmarkStreamingResult>& GetStreamingResults() const { return m_StreamingResults; }
+        const std::vector<WorldBenchmarkLargeSceneResult>& GetLargeSceneResults() const { return m_LargeSceneResults; }
+
+    private:
+        WorldBenchmarkDeserializationResult MeasureDeserialization(uint32_t entityCount);
+        WorldBenchmarkDestructionResult MeasureDestruction(uint32_t entityCount);
+        WorldBenchmarkInstantiationResult MeasureInstantiation(uint32_t instanceCount);
+        WorldBenchmarkSpawnResult MeasureSpawn(uint32_t entityCount);
+        WorldBenchmarkSpatialQueryResult MeasureSpatialQueries(uint32_t entityCount);
+        WorldBenchmarkStreamingResult MeasureStreaming(uint32_t entityCount);
+        WorldBenchmarkLargeSceneResult MeasureLargeScene(const SceneGeneratorSettings& sceneSettings);
+        std::vector<std::shared_ptr<Entity>> CreateEntityGroups(uint32_t entityCount); // Returns the group roots.
+        void RemoveEntitiesFrom(uint32_t firstEntityIndex); // Removes every entity we appended past the given position of the World's entities, through World::EntityRemove.
+
+    private:
+        static constexpr uint32_t m_EntitiesPerGroup = 10;
+        static constexpr uint32_t m_EntityIDBase = 0x80000000; // Above anything GenerateObjectID() hands out, so our entities never collide with the scene's.
+        static constexpr uint32_t m_CrateChildCount = 2;
+        static constexpr uint32_t m_FileLoadInstanceCount = 100;
+        static constexpr uint32_t m_SpatialQueryCount = 1000;
+        static constexpr uint32_t m_LinearQueryCount = 100; // Linear passes over our largest runs are slow enough that fewer suffice.
+        static constexpr float m_SpatialCellSize = 8.0f;    // Our entities are scattered a single entity per cube of this size on average.
+        static constexpr const char* m_ScenePath = "../ProfilerLogs/WorldBenchmark.aurora";
+        static constexpr const char* m_PrefabPath = "../ProfilerLogs/WorldBenchmark_Crate.prefab";
+        static constexpr const char* m_CellDirectory = "../ProfilerLogs/WorldBenchmark_Cells";
+        static constexpr uint32_t m_StreamingGridSize = 8; // Cells along either axis.
+        static constexpr const char* m_LargeScenePath = "../ProfilerLogs/WorldBenchmark_LargeScene.aurora";
+        static constexpr uint32_t m_LargeSceneTickCount = 30; // Of both steady and churning frames.
+        static constexpr float m_LargeSceneDeltaTime = 1.0f / 60.0f;
+
+        EngineContext* m_EngineContext = nullptr;
+        World* m_World = nullptr;
+        uint32_t m_NextEntityID = m_EntityIDBase;
+
+        std::vector<WorldBenchmarkDeserializationResult> m_DeserializationResults;
+        std::vector<WorldBenchmarkDestructionResult> m_DestructionResults;
+        std::vector<WorldBenchmarkInstantiationResult> m_InstantiationResults;
+        std::vector<WorldBenchmarkSpawnResult> m_SpawnResults;
+        std::vector<WorldBenchmarkSpatialQueryResult> m_SpatialQueryResults;
+        std::vector<WorldBenchmarkStreamingResult> m_StreamingResults;
+        std::vector<WorldBenchmarkLargeSceneResult> m_LargeSceneResults;
+        SceneGeneratorSettings m_LargeSceneSettings; // Of our last large scene run, sans its entity counts.
+    };
+}
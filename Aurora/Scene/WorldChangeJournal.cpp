@@ -0,0 +1,34 @@
+#include "Aurora.h"
+#include "WorldChangeJournal.h"
+#include "Entity.h"
+
+namespace Aurora
+{
+    void WorldChangeJournal::Record(WorldChangeType changeType, const Entity* entity, ComponentType componentType)
+    {
+        WorldChange change;
+        change.m_Type = changeType;
+        change.m_ComponentType = componentType;
+        change.m_EntityHandle = entity->GetEntityHandle();
+        change.m_EntityID = entity->GetObjectID();
+
+        m_RecordLock.Lock();
+        m_RecordingChanges.push_back(change);
+        m_RecordingTypeMask |= GetTypeMask(changeType);
+        m_RecordLock.Unlock();
+    }
+
+    void WorldChangeJournal::Publish()
+    {
+        m_RecordLock.Lock();
+
+        // The previously published buffer becomes our recording one, keeping its capacity.
+        std::swap(m_RecordingChanges, m_PublishedChanges);
+        m_RecordingChanges.clear();
+        m_PublishedTypeMask = m_RecordingTypeMask;
+        m_RecordingTypeMask = 0;
+        m_FrameIndex++;
+
+        m_RecordLock.Unlock();
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "ComponentStorage.h"
+#include "Components/IComponent.h"
+#include "../Threading/Spinlock.h"
+
+/* == World Change Journal ==
+
+    Records what changed within the World over a frame, so that systems mirroring the world (scene saves, GPU buffers, editor widgets) can do work proportional to the
+    changes rather than re-scanning every entity. The World records:
+
+    - Entities being created and destroyed (as they enter and leave its indices).
+    - Components being added to and removed from entities, each naming the component's type.
+    - Transforms whose world matrix was recomputed, including the descendants of those moved.
+    - Entities whose parent or children changed.
+
+    Recording appends a small record under a spinlock, and may happen from any thread. At the end of every World::Tick, the records of the frame are published: GetChanges()
+    returns them until the next tick ends, whilst recording continues into a second buffer. Both buffers keep their memory, so a steady frame allocates nothing.
+
+    Records refer to entities by handle and ID. The handles of destroyed entities no longer resolve, but remain usable as keys. An entity may appear several times in a
+    frame, such as when created and moved at once. Consumers which miss a frame (their last seen frame index isn't one behind the current) should rescan in full.
+*/
+
+namespace Aurora
+{
+    class Entity;
+
+    enum class WorldChangeType : uint8_t
+    {
+        EntityCreated,
+        EntityDestroyed,
+        ComponentAdded,
+        ComponentRemoved,
+        TransformUpdated,
+        HierarchyChanged
+    };
+
+    struct WorldChange
+    {
+        WorldChangeType m_Type = WorldChangeType::EntityCreated;
+        ComponentType m_ComponentType = ComponentType::Unknown; // For component changes.
+        EntityHandle m_EntityHandle;
+        uint32_t m_EntityID = 0;
+    };
+
+    class WorldChangeJournal
+    {
+    public:
+        // May be called from any thread.
+        void Record(WorldChangeType changeType, const Entity* entity, ComponentType componentType = ComponentType::Unknown);
+
+        // Called by the World at the end of its tick. Makes the changes recorded since the last call available through GetChanges().
+        void Publish();
+
+        const std::vector<WorldChange>& GetChanges() const { return m_PublishedChanges; }
+        bool HasChanges(WorldChangeType changeType) const { return (m_PublishedTypeMask & GetTypeMask(changeType)) != 0; } // O(1) - Whether any published change is of the given type.
+        uint64_t GetFrameIndex() const { return m_FrameIndex; } // Of the published changes. Increments with every publish.
+
+    private:
+        static constexpr uint32_t GetTypeMask(WorldChangeType changeType) { return static_cast<uint32_t>(1) << static_cast<uint32_t>(changeType); }
+
+    private:
+        Spinlock m_RecordLock;
+        std::vector<WorldChange> m_RecordingChanges;
+        uint32_t m_RecordingTypeMask = 0;
+
+        std::vector<WorldChange> m_PublishedChanges;
+        uint32_t m_PublishedTypeMask = 0;
+        uint64_t m_FrameIndex = 0;
+    };
+}
@@ -0,0 +1,309 @@
+#include "Aurora.h"
+#include "WorldStreamer.h"
+#include "World.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Aurora
+{
+    WorldStreamer::WorldStreamer(World* world, IOService* ioService)
+    {
+        m_World = world;
+        m_IOService = ioService;
+    }
+
+    WorldStreamer::~WorldStreamer()
+    {
+        // Reads in flight write into our cells, which must outlive them.
+        for (WorldCell* cell : m_ReadingCells)
+        {
+            m_IOService->Wait(cell->m_ReadHandle);
+        }
+    }
+
+    void WorldStreamer::Enable(const WorldStreamingSettings& streamingSettings)
+    {
+        Disable();
+
+        m_Settings = streamingSettings;
+        m_Settings.m_UnloadDistance = std::max(m_Settings.m_UnloadDistance, m_Settings.m_LoadDistance);
+        m_Statistics = WorldStreamingStatistics();
+        m_IsEnabled = true;
+    }
+
+    void WorldStreamer::Disable()
+    {
+        if (!m_IsEnabled)
+        {
+            return;
+        }
+
+        for (WorldCell* cell : m_ReadingCells)
+        {
+            m_IOService->Wait(cell->m_ReadHandle);
+        }
+
+        for (const auto& [cellKey, cell] : m_Cells)
+        {
+            UnloadCell(*cell);
+        }
+
+        m_Cells.clear();
+        m_ReadingCells.clear();
+        m_LinkQueue.clear();
+        m_IsEnabled = false;
+    }
+
+    void WorldStreamer::Update(const XMFLOAT3& focusPosition)
+    {
+        if (!m_IsEnabled)
+        {
+            return;
+        }
+
+        UnloadDistantCells(focusPosition);
+        RequestCells(focusPosition);
+        PollReads();
+        LinkCells();
+
+        m_Statistics.m_CellsLoaded = 0;
+        for (const auto& [cellKey, cell] : m_Cells)
+        {
+            m_Statistics.m_CellsLoaded += cell->m_State == WorldCellState::Loaded ? 1 : 0;
+        }
+        m_Statistics.m_CellsPending = static_cast<uint32_t>(m_ReadingCells.size() + m_LinkQueue.size());
+    }
+
+    void WorldStreamer::RequestCells(const XMFLOAT3& focusPosition)
+    {
+        const int32_t focusCellX = GetCellCoordinate(focusPosition.x);
+        const int32_t focusCellZ = GetCellCoordinate(focusPosition.z);
+        const int32_t cellRadius = static_cast<int32_t>(std::ceil(m_Settings.m_LoadDistance / m_Settings.m_CellSize));
+
+        for (int32_t cellZ = focusCellZ - cellRadius; cellZ <= focusCellZ + cellRadius; cellZ++)
+        {
+            for (int32_t cellX = focusCellX - cellRadius; cellX <= focusCellX + cellRadius; cellX++)
+            {
+                // The corners of our square lie beyond the load distance, and are skipped before anything is allocated for them.
+                if (GetDistanceToCell(cellX, cellZ, focusPosition) > m_Settings.m_LoadDistance || m_Cells.find(GetCellKey(cellX, cellZ)) != m_Cells.end())
+                {
+                    continue;
+                }
+
+                std::unique_ptr<WorldCell> cell = std::make_unique<WorldCell>();
+                cell->m_X = cellX;
+                cell->m_Z = cellZ;
+
+                // Cells without entities have no file, hence a missing one is no error.
+                std::vector<IOReadRequest> cellRequests(1);
+                cellRequests[0].m_FilePath = GetCellFilePath(cellX, cellZ);
+                cellRequests[0].m_DestinationBuffer = &cell->m_FileData;
+                cellRequests[0].m_IsMissingFileExpected = true;
+                cell->m_ReadHandle = m_IOService->SubmitReads(std::move(cellRequests));
+                m_ReadingCells.push_back(cell.get());
+                m_Cells.emplace(GetCellKey(cellX, cellZ), std::move(cell));
+            }
+        }
+    }
+
+    void WorldStreamer::UnloadDistantCells(const XMFLOAT3& focusPosition)
+    {
+        for (auto it = m_Cells.begin(); it != m_Cells.end();)
+        {
+            WorldCell& cell = *it->second;
+            if (GetDistanceToCell(cell.m_X, cell.m_Z, focusPosition) <= m_Settings.m_UnloadDistance)
+            {
+                cell.m_IsUnwanted = false;
+                ++it;
+                continue;
+            }
+
+            // Reads can't be cancelled, so the cell is kept around until its read completes.
+            if (cell.m_State == WorldCellState::Reading)
+            {
+                cell.m_IsUnwanted = true;
+                ++it;
+                continue;
+            }
+
+            if (cell.m_State == WorldCellState::Linking)
+            {
+                m_LinkQueue.erase(std::find(m_LinkQueue.begin(), m_LinkQueue.end(), &cell));
+            }
+
+            UnloadCell(cell);
+            it = m_Cells.erase(it);
+        }
+    }
+
+    void WorldStreamer::PollReads()
+    {
+        for (uint32_t i = 0; i < m_ReadingCells.size();)
+        {
+            WorldCell* cell = m_ReadingCells[i];
+            if (!m_IOService->IsComplete(cell->m_ReadHandle))
+            {
+                i++;
+                continue;
+            }
+
+            m_ReadingCells[i] = m_ReadingCells.back();
+            m_ReadingCells.pop_back();
+
+            const IOStatus readStatus = cell->m_ReadHandle->m_Requests.front().m_Status;
+            cell->m_ReadHandle.reset();
+
+            if (cell->m_IsUnwanted)
+            {
+                m_Cells.erase(GetCellKey(cell->m_X, cell->m_Z));
+                continue;
+            }
+
+            if (readStatus != IOStatus::Success)
+            {
+                if (readStatus != IOStatus::FileNotFound)
+                {
+                    AURORA_ERROR(LogLayer::Serialization, "Failed to read world cell \"%s\".", GetCellFilePath(cell->m_X, cell->m_Z).c_str());
+                }
+
+                cell->m_FileData.clear();
+                cell->m_State = WorldCellState::Missing;
+                continue;
+            }
+
+            // Cell files are written by World::SerializeRootEntities - the root count, their IDs, then the roots themselves. Every root's ID is written again alongside it.
+            cell->m_Deserializer = std::make_unique<BinarySerializer>(cell->m_FileData);
+            cell->m_RootCount = cell->m_Deserializer->ReadAs<uint32_t>();
+            for (uint32_t rootIndex = 0; rootIndex < cell->m_RootCount; rootIndex++)
+            {
+                cell->m_Deserializer->ReadAs<uint32_t>();
+            }
+
+            cell->m_LinkedRoots.reserve(cell->m_RootCount);
+            cell->m_State = WorldCellState::Linking;
+            m_LinkQueue.push_back(cell);
+        }
+    }
+
+    void WorldStreamer::LinkCells()
+    {
+        using StreamingClock = std::chrono::steady_clock;
+        const StreamingClock::time_point startTime = StreamingClock::now();
+        const std::chrono::duration<double, std::milli> frameBudget(m_Settings.m_FrameBudgetMilliseconds);
+
+        m_Statistics.m_RootsLinkedLastUpdate = 0;
+        while (!m_LinkQueue.empty())
+        {
+            if (m_Statistics.m_RootsLinkedLastUpdate > 0 && StreamingClock::now() - startTime >= frameBudget)
+            {
+                break;
+            }
+
+            WorldCell* cell = m_LinkQueue.front();
+            if (LinkNextRoot(*cell))
+            {
+                // Done with the file's contents.
+                cell->m_Deserializer.reset();
+                cell->m_FileData = std::vector<uint8_t>();
+                cell->m_State = WorldCellState::Loaded;
+                m_LinkQueue.pop_front();
+            }
+        }
+
+        m_Statistics.m_LinkMillisecondsLastUpdate = std::chrono::duration<double, std::milli>(StreamingClock::now() - startTime).count();
+        m_Statistics.m_LinkMillisecondsPeak = std::max(m_Statistics.m_LinkMillisecondsPeak, m_Statistics.m_LinkMillisecondsLastUpdate);
+    }
+
+    bool WorldStreamer::LinkNextRoot(WorldCell& cell)
+    {
+        if (cell.m_LinkedRoots.size() < cell.m_RootCount)
+        {
+            // Children resolve their parents by ID as they are read, which stays within the hierarchy being linked.
+            std::shared_ptr<Entity> rootEntity = m_World->EntityCreate();
+            rootEntity->Deserialize(cell.m_Deserializer.get(), nullptr);
+            cell.m_LinkedRoots.push_back(rootEntity->GetEntityHandle());
+            m_Statistics.m_RootsLinkedLastUpdate++;
+        }
+
+        return cell.m_LinkedRoots.size() >= cell.m_RootCount;
+    }
+
+    void WorldStreamer::UnloadCell(WorldCell& cell)
+    {
+        // Roots may have been destroyed by gameplay code since, whose handles no longer resolve.
+        for (EntityHandle rootHandle : cell.m_LinkedRoots)
+        {
+            if (Entity* rootEntity = m_World->GetEntityByHandle(rootHandle))
+            {
+                m_World->EntityRemove(rootEntity->GetPointerShared());
+            }
+        }
+
+        cell.m_LinkedRoots.clear();
+    }
+
+    bool WorldStreamer::SaveCells(const std::vector<std::shared_ptr<Entity>>& rootEntities) const
+    {
+        if (!FileSystem::Exists(m_Settings.m_CellDirectory) && !FileSystem::CreateDirectory_(m_Settings.m_CellDirectory))
+        {
+            AURORA_ERROR(LogLayer::Serialization, "Failed to create world cell directory \"%s\".", m_Settings.m_CellDirectory.c_str());
+            return false;
+        }
+
+        std::unordered_map<uint64_t, std::vector<std::shared_ptr<Entity>>> cellRoots;
+        for (const std::shared_ptr<Entity>& rootEntity : rootEntities)
+        {
+            const XMFLOAT3 position = rootEntity->GetTransform()->GetPosition();
+            cellRoots[GetCellKey(GetCellCoordinate(position.x), GetCellCoordinate(position.z))].push_back(rootEntity);
+        }
+
+        for (const auto& [cellKey, roots] : cellRoots)
+        {
+            const int32_t cellX = static_cast<int32_t>(static_cast<uint32_t>(cellKey >> 32));
+            const int32_t cellZ = static_cast<int32_t>(static_cast<uint32_t>(cellKey));
+            const std::string cellFilePath = GetCellFilePath(cellX, cellZ);
+
+            BinarySerializer binarySerializer(cellFilePath, SerializerFlag::SerializerMode_Write);
+            if (!binarySerializer.IsStreamOpen())
+            {
+                AURORA_ERROR(LogLayer::Serialization, "Failed to open \"%s\" for writing.", cellFilePath.c_str());
+                return false;
+            }
+
+            m_World->SerializeRootEntities(&binarySerializer, roots);
+        }
+
+        AURORA_INFO(LogLayer::Serialization, "Saved %u root entities across %u world cells.", static_cast<uint32_t>(rootEntities.size()), static_cast<uint32_t>(cellRoots.size()));
+        return true;
+    }
+
+    std::string WorldStreamer::GetCellFilePath(int32_t cellX, int32_t cellZ) const
+    {
+        return m_Settings.m_CellDirectory + "/Cell_" + std::to_string(cellX) + "_" + std::to_string(cellZ) + EXTENSION_SCENE;
+    }
+
+    bool WorldStreamer::IsCellLoaded(int32_t cellX, int32_t cellZ) const
+    {
+        const auto cell = m_Cells.find(GetCellKey(cellX, cellZ));
+        return cell != m_Cells.end() && cell->second->m_State == WorldCellState::Loaded;
+    }
+
+    bool WorldStreamer::IsIdle() const
+    {
+        return m_ReadingCells.empty() && m_LinkQueue.empty();
+    }
+
+    int32_t WorldStreamer::GetCellCoordinate(float position) const
+    {
+        return static_cast<int32_t>(std::floor(position / m_Settings.m_CellSize));
+    }
+
+    float WorldStreamer::GetDistanceToCell(int32_t cellX, int32_t cellZ, const XMFLOAT3& focusPosition) const
+    {
+        const float centerX = (static_cast<float>(cellX) + 0.5f) * m_Settings.m_CellSize;
+        const float centerZ = (static_cast<float>(cellZ) + 0.5f) * m_Settings.m_CellSize;
+
+        return std::sqrt((centerX - focusPosition.x) * (centerX - focusPosition.x) + (centerZ - focusPosition.z) * (centerZ - focusPosition.z));
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <DirectXMath.h>
+#include "ComponentStorage.h"
+#include "../Threading/IOService.h"
+
+/* == World Streamer ==
+
+    Open world levels are too large to load at once, let alone all at the start. The streamer instead partitions a level into square cells on the XZ plane, each saved as
+    a scene file of its own holding the root entities positioned within it (alongside their descendants). As the focus (usually the camera) moves, cells within the load
+    distance are streamed in and cells past the unload distance are removed again. The unload distance should exceed the load distance, so that a focus wandering along
+    a cell's boundary doesn't have it loaded and unloaded over and over.
+
+    - Reading: Cell files are read on the IO Service's threads (see IOService.h), never blocking the frame. Cells with no file are remembered as missing until they leave
+      the unload distance.
+    - Linking: Read cells are deserialized into the World a root hierarchy at a time, from the World's tick. Entities can't be created off the World's thread, as its slots,
+      indices and component storages are not thread safe. Linking stops once the frame budget is spent and resumes on the next tick, so a large cell spreads over several
+      frames rather than spiking one. A single root hierarchy is always linked per tick to guarantee progress, hence cells should be made of many moderate hierarchies.
+    - Unloading: The roots linked from a cell are removed through World::EntityRemove, and destroyed in a single batch at the end of the tick.
+
+    Cells are saved through SaveCells(), which sorts the given roots into cells by their world position. Entities created at runtime belong to no cell, and stay loaded.
+*/
+
+namespace Aurora
+{
+    class World;
+    class Entity;
+    class BinarySerializer;
+
+    struct WorldStreamingSettings
+    {
+        std::string m_CellDirectory;           // Holds a scene file per cell. See GetCellFilePath().
+        float m_CellSize = 64.0f;
+        float m_LoadDistance = 128.0f;         // From the focus to a cell's center, on the XZ plane.
+        float m_UnloadDistance = 192.0f;
+        float m_FrameBudgetMilliseconds = 2.0f; // Spent linking entities per tick.
+    };
+
+    enum class WorldCellState : uint32_t
+    {
+        Reading,   // Waiting on the IO Service.
+        Linking,   // Queued or being deserialized into the World.
+        Loaded,
+        Missing    // There is no file for this cell.
+    };
+
+    struct WorldStreamingStatistics
+    {
+        uint32_t m_CellsLoaded = 0;
+        uint32_t m_CellsPending = 0;             // Reading or linking.
+        uint32_t m_RootsLinkedLastUpdate = 0;
+        double m_LinkMillisecondsLastUpdate = 0.0;
+        double m_LinkMillisecondsPeak = 0.0;     // Over every update since streaming was enabled.
+    };
+
+    class WorldStreamer
+    {
+    public:
+        WorldStreamer(World* world, IOService* ioService);
+        ~WorldStreamer();
+
+        // Streaming starts upon our next update. Disabling unloads every streamed cell.
+        void Enable(const WorldStreamingSettings& streamingSettings);
+        void Disable();
+        bool IsEnabled() const { return m_IsEnabled; }
+
+        // Called by the World every tick, with its camera's position. Requests, links and unloads cells around the given focus.
+        void Update(const DirectX::XMFLOAT3& focusPosition);
+
+        // Writes the given roots (and their descendants) into cell files within our settings' cell directory, sorted by their world position. Cells without roots
+        // aren't written, hence clear the directory of cells from previous saves first.
+        bool SaveCells(const std::vector<std::shared_ptr<Entity>>& rootEntities) const;
+        std::string GetCellFilePath(int32_t cellX, int32_t cellZ) const;
+
+        bool IsCellLoaded(int32_t cellX, int32_t cellZ) const;
+        bool IsIdle() const; // Whether no cell is being read or linked.
+        const WorldStreamingSettings& GetSettings() const { return m_Settings; }
+        const WorldStreamingStatistics& GetStatistics() const { return m_Statistics; }
+
+    private:
+        struct WorldCell
+        {
+            int32_t m_X = 0;
+            int32_t m_Z = 0;
+            WorldCellState m_State = WorldCellState::Reading;
+            bool m_IsUnwanted = false;                          // Left the unload distance whilst reading, and is dropped once the read completes.
+
+            IOHandle m_ReadHandle;
+            std::vector<uint8_t> m_FileData;                    // Declared ahead of our deserializer, which reads from it.
+            std::unique_ptr<BinarySerializer> m_Deserializer;   // Whilst linking.
+            uint32_t m_RootCount = 0;
+
+            std::vector<EntityHandle> m_LinkedRoots;
+        };
+
+        static uint64_t GetCellKey(int32_t cellX, int32_t cellZ) { return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellZ); }
+        int32_t GetCellCoordinate(float position) const;
+        float GetDistanceToCell(int32_t cellX, int32_t cellZ, const DirectX::XMFLOAT3& focusPosition) const; // From the cell's center, on the XZ plane.
+
+        void RequestCells(const DirectX::XMFLOAT3& focusPosition);
+        void UnloadDistantCells(const DirectX::XMFLOAT3& focusPosition);
+        void PollReads();
+        void LinkCells();
+        bool LinkNextRoot(WorldCell& cell); // Returns whether the cell is done.
+        void UnloadCell(WorldCell& cell);
+
+    private:
+        World* m_World = nullptr;
+        IOService* m_IOService = nullptr;
+
+        bool m_IsEnabled = false;
+        WorldStreamingSettings m_Settings;
+        WorldStreamingStatistics m_Statistics;
+
+        std::unordered_map<uint64_t, std::unique_ptr<WorldCell>> m_Cells; // Every cell we know of which isn't unloaded, by GetCellKey().
+        std::vector<WorldCell*> m_ReadingCells;
+        std::deque<WorldCell*> m_LinkQueue;                                 // In the order their reads completed.
+    };
+}
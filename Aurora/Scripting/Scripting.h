@@ -17,6 +17,7 @@ namespace Aurora
 
         bool Initialize() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_Entities | SubsystemResource_Transforms, SubsystemResource_Scripts, false }; }
 
         static bool LoadAuroraRuntimeAssembly(const std::string& assemblyPath);
         static bool LoadApplicationAssembly(const std::string& path);
@@ -25,8 +25,8 @@ namespace Aurora
         }
         else if (m_SerializerFlags & SerializerFlag::SerializerMode_Read)
         {
-            m_InputStream.open(filePath, streamFlags);
-            if (m_InputStream.fail())
+            m_InputStream.rdbuf(&m_InputFileBuffer);
+            if (!m_InputFileBuffer.open(filePath, static_cast<std::ios::openmode>(streamFlags)))
             {
                 AURORA_ERROR(LogLayer::Serialization, "Failed to open \"%s\" for reading.", filePath.c_str());
                 return;
@@ -36,6 +36,14 @@ namespace Aurora
         m_IsStreamOpen = true;
     }
 
+    BinarySerializer::BinarySerializer(const std::vector<uint8_t>& data)
+    {
+        m_SerializerFlags = SerializerFlag::SerializerMode_Read;
+        m_InputMemoryBuffer.SetData(data);
+        m_InputStream.rdbuf(&m_InputMemoryBuffer);
+        m_IsStreamOpen = true;
+    }
+
     BinarySerializer::~BinarySerializer()
     {
         CloseStream();
@@ -51,7 +59,7 @@ namespace Aurora
         else if (m_SerializerFlags & SerializerFlag::SerializerMode_Read)
         {
             m_InputStream.clear();
-            m_InputStream.close();
+            m_InputFileBuffer.close();
         }
     }
 
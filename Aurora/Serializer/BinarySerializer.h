@@ -1,6 +1,8 @@
 #pragma once
 #include <vector>
 #include <fstream>
+#include <istream>
+#include <streambuf>
 #include <DirectXMath.h>
 
 using namespace DirectX;
@@ -20,6 +22,7 @@ namespace Aurora
     {
     public:
         BinarySerializer(const std::string& filePath, uint32_t serializerFlags);
+        BinarySerializer(const std::vector<uint8_t>& data); // Reads from memory, such as a file read through the IOService. The data must outlive the serializer.
         ~BinarySerializer();
 
         bool IsStreamOpen() const { return m_IsStreamOpen; }
@@ -117,9 +120,22 @@ namespace Aurora
             return value;
         }
 
+    private:
+        // Lets our input stream read straight out of a buffer in memory, without copying it.
+        struct MemoryStreamBuffer : public std::streambuf
+        {
+            void SetData(const std::vector<uint8_t>& data)
+            {
+                char* begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data.data()));
+                setg(begin, begin, begin + data.size());
+            }
+        };
+
     private:
         std::ofstream m_OutputStream;
-        std::ifstream m_InputStream;
+        std::filebuf m_InputFileBuffer;
+        MemoryStreamBuffer m_InputMemoryBuffer;
+        std::istream m_InputStream{ nullptr }; // Reads from either of the buffers above.
         uint32_t m_SerializerFlags;
         bool m_IsStreamOpen;
     };
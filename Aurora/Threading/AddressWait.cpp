@@ -0,0 +1,52 @@
+#include "Aurora.h"
+#include "AddressWait.h"
+#include <thread>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+    #pragma comment (lib, "Synchronization.lib")
+#elif defined(__linux__)
+    #include <climits>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace Aurora
+{
+    // Both the OS calls below take the address of the value itself.
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Address waits require atomics of the same size as their value.");
+
+    void AddressWait::Wait(const std::atomic<uint32_t>& address, uint32_t expectedValue)
+    {
+        while (address.load(std::memory_order_acquire) == expectedValue)
+        {
+#if defined(_WIN32)
+            WaitOnAddress(const_cast<std::atomic<uint32_t>*>(&address), &expectedValue, sizeof(uint32_t), INFINITE);
+#elif defined(__linux__)
+            syscall(SYS_futex, &address, FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+#else
+            std::this_thread::yield();
+#endif
+        }
+    }
+
+    void AddressWait::WakeOne(std::atomic<uint32_t>& address)
+    {
+#if defined(_WIN32)
+        WakeByAddressSingle(&address);
+#elif defined(__linux__)
+        syscall(SYS_futex, &address, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+    }
+
+    void AddressWait::WakeAll(std::atomic<uint32_t>& address)
+    {
+#if defined(_WIN32)
+        WakeByAddressAll(&address);
+#elif defined(__linux__)
+        syscall(SYS_futex, &address, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/* == Address Wait ==
+
+    Puts threads to sleep on a 32-bit atomic until another thread changes it, and wakes them afterwards. This is what std::atomic::wait/notify does, though that requires
+    C++20, and our waits sit in headers (such as Spinlock.h) that reach nearly every translation unit. We call the OS directly instead: WaitOnAddress on Windows and a
+    private futex on Linux. Elsewhere, waiters fall back to yielding.
+
+    Waking is a system call, hence callers should only wake once they know somebody may be asleep (as our Spinlock tracks within its lock word).
+*/
+
+namespace Aurora
+{
+    class AddressWait
+    {
+    public:
+        static void Wait(const std::atomic<uint32_t>& address, uint32_t expectedValue); // Returns once the value differs from the expected one. Spurious wakes are handled within.
+        static void WakeOne(std::atomic<uint32_t>& address);
+        static void WakeAll(std::atomic<uint32_t>& address);
+    };
+}
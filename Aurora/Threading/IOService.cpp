@@ -0,0 +1,494 @@
+#include "Aurora.h"
+#include "IOService.h"
+#include "AddressWait.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Aurora
+{
+    // An open file of an IO thread. Kept open across requests so consecutive reads of the same file skip reopening it.
+    class IOFile
+    {
+    public:
+        ~IOFile() { Close(); }
+
+        bool Open(const std::string& filePath)
+        {
+            if (IsOpen() && filePath == m_FilePath)
+            {
+                return true;
+            }
+
+            Close();
+#if defined(_WIN32)
+            m_Handle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            LARGE_INTEGER fileSize;
+            if (m_Handle != INVALID_HANDLE_VALUE && GetFileSizeEx(m_Handle, &fileSize))
+            {
+                m_Size = static_cast<uint64_t>(fileSize.QuadPart);
+            }
+#elif defined(__linux__)
+            m_Descriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat fileStatus;
+            if (m_Descriptor >= 0 && fstat(m_Descriptor, &fileStatus) == 0)
+            {
+                m_Size = static_cast<uint64_t>(fileStatus.st_size);
+            }
+#else
+            m_Stream.open(filePath, std::ios::binary | std::ios::ate);
+            if (m_Stream.is_open())
+            {
+                m_Size = static_cast<uint64_t>(m_Stream.tellg());
+            }
+#endif
+            m_FilePath = IsOpen() ? filePath : std::string();
+            return IsOpen();
+        }
+
+        void Close()
+        {
+#if defined(_WIN32)
+            if (m_Handle != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_Handle);
+                m_Handle = INVALID_HANDLE_VALUE;
+            }
+#elif defined(__linux__)
+            if (m_Descriptor >= 0)
+            {
+                close(m_Descriptor);
+                m_Descriptor = -1;
+            }
+#else
+            m_Stream.close();
+#endif
+            m_FilePath.clear();
+            m_Size = 0;
+        }
+
+        bool IsOpen() const
+        {
+#if defined(_WIN32)
+            return m_Handle != INVALID_HANDLE_VALUE;
+#elif defined(__linux__)
+            return m_Descriptor >= 0;
+#else
+            return m_Stream.is_open();
+#endif
+        }
+
+        uint64_t GetSize() const { return m_Size; }
+
+        // Positional read. Returns the bytes read, which fall short of the requested size only upon reaching the end of the file or an error.
+        uint64_t Read(uint64_t offset, uint64_t size, void* destination)
+        {
+            uint8_t* bytes = static_cast<uint8_t*>(destination);
+            uint64_t bytesRead = 0;
+
+            while (bytesRead < size)
+            {
+                const uint64_t chunkSize = std::min<uint64_t>(size - bytesRead, 1ull << 30); // Both APIs cap the size of a single read.
+#if defined(_WIN32)
+                OVERLAPPED overlapped = {};
+                overlapped.Offset = static_cast<DWORD>(offset + bytesRead);
+                overlapped.OffsetHigh = static_cast<DWORD>((offset + bytesRead) >> 32);
+
+                DWORD chunkRead = 0;
+                if (!::ReadFile(m_Handle, bytes + bytesRead, static_cast<DWORD>(chunkSize), &chunkRead, &overlapped) || chunkRead == 0)
+                {
+                    break;
+                }
+#elif defined(__linux__)
+                const ssize_t chunkRead = pread(m_Descriptor, bytes + bytesRead, static_cast<size_t>(chunkSize), static_cast<off_t>(offset + bytesRead));
+                if (chunkRead <= 0)
+                {
+                    break;
+                }
+#else
+                m_Stream.clear();
+                m_Stream.seekg(static_cast<std::streamoff>(offset + bytesRead));
+                m_Stream.read(reinterpret_cast<char*>(bytes + bytesRead), static_cast<std::streamsize>(chunkSize));
+                const std::streamsize chunkRead = m_Stream.gcount();
+                if (chunkRead <= 0)
+                {
+                    break;
+                }
+#endif
+                bytesRead += static_cast<uint64_t>(chunkRead);
+            }
+
+            return bytesRead;
+        }
+
+    private:
+        std::string m_FilePath;
+        uint64_t m_Size = 0;
+#if defined(_WIN32)
+        HANDLE m_Handle = INVALID_HANDLE_VALUE;
+#elif defined(__linux__)
+        int m_Descriptor = -1;
+#else
+        std::ifstream m_Stream;
+#endif
+    };
+
+    static void ServiceRequest(IOFile& file, IOReadRequest& request)
+    {
+        if (!file.Open(request.m_FilePath))
+        {
+            request.m_Status = IOStatus::FileNotFound;
+            if (!request.m_IsMissingFileExpected)
+            {
+                AURORA_ERROR(LogLayer::Engine, "File not found: %s.", request.m_FilePath.c_str());
+            }
+
+            return;
+        }
+
+        const uint64_t availableSize = request.m_Offset < file.GetSize() ? file.GetSize() - request.m_Offset : 0;
+        const uint64_t size = request.m_Size == g_IOReadToEnd ? availableSize : request.m_Size;
+
+        void* destination = request.m_Destination;
+        if (destination == nullptr && request.m_DestinationBuffer != nullptr)
+        {
+            request.m_DestinationBuffer->resize(static_cast<size_t>(size));
+            destination = request.m_DestinationBuffer->data();
+        }
+
+        if (destination == nullptr && size != 0)
+        {
+            request.m_Status = IOStatus::ReadError;
+            AURORA_ERROR(LogLayer::Engine, "Read request for \"%s\" has no destination.", request.m_FilePath.c_str());
+            return;
+        }
+
+        request.m_BytesRead = file.Read(request.m_Offset, size, destination);
+        request.m_Status = request.m_BytesRead == size ? IOStatus::Success : IOStatus::ReadError;
+
+        if (request.m_DestinationBuffer != nullptr && request.m_Destination == nullptr)
+        {
+            request.m_DestinationBuffer->resize(static_cast<size_t>(request.m_BytesRead));
+        }
+
+        if (request.m_Status != IOStatus::Success)
+        {
+            AURORA_ERROR(LogLayer::Engine, "Read %llu of %llu bytes from \"%s\".", static_cast<unsigned long long>(request.m_BytesRead), static_cast<unsigned long long>(size), request.m_FilePath.c_str());
+        }
+    }
+
+    bool IOBatch::IsSuccessful() const
+    {
+        return std::all_of(m_Requests.begin(), m_Requests.end(), [](const IOReadRequest& request) { return request.m_Status == IOStatus::Success; });
+    }
+
+    IOService::IOService(EngineContext* engineContext) : ISubsystem(engineContext)
+    {
+
+    }
+
+    bool IOService::Initialize()
+    {
+        m_Threading = m_EngineContext->GetSubsystem<Threading>();
+        if (!m_Threading)
+        {
+            AURORA_ERROR(LogLayer::Engine, "The IO Service requires the Threading subsystem to post its completions.");
+            return false;
+        }
+
+        ThreadingConfiguration configuration;
+        if (Settings* settings = m_EngineContext->GetSubsystem<Settings>())
+        {
+            configuration = settings->GetThreadingConfiguration();
+        }
+
+        m_IsRunning = true;
+        const uint32_t threadCount = std::max(configuration.m_IOWorkerCount, 1u);
+        for (uint32_t threadIndex = 0; threadIndex < threadCount; threadIndex++)
+        {
+            std::thread ioThread([this, threadIndex] { IOThreadLoop(threadIndex); });
+
+            const std::string threadName = "IO_" + std::to_string(threadIndex);
+            Threading::SetupWorkerThread(ioThread, threadName);
+            Instrumentor::GetInstance().SetThreadName(Instrumentor::GetThreadID(ioThread.get_id()), threadName);
+            AURORA_INFO(LogLayer::Engine, "Thread Initiated: %s", threadName.c_str());
+
+            m_IOThreads.emplace_back(std::move(ioThread));
+        }
+
+        return true;
+    }
+
+    void IOService::Shutdown()
+    {
+        std::deque<PendingRead> cancelledReads;
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_IsRunning = false;
+            cancelledReads.swap(m_PendingReads);
+        }
+        m_QueueCondition.notify_all();
+
+        for (std::thread& ioThread : m_IOThreads)
+        {
+            if (ioThread.joinable())
+            {
+                ioThread.join();
+            }
+        }
+        m_IOThreads.clear();
+
+        // Nobody is left to run completion jobs, but waiters must still be released.
+        m_Threading = nullptr;
+        for (PendingRead& pendingRead : cancelledReads)
+        {
+            pendingRead.m_Batch->m_Requests[pendingRead.m_RequestIndex].m_Status = IOStatus::Cancelled;
+            m_PendingReadCount.fetch_sub(1, std::memory_order_relaxed);
+            CompleteRequest(pendingRead.m_Batch);
+        }
+    }
+
+    IOHandle IOService::SubmitReads(std::vector<IOReadRequest> requests, IOCompletionFunction onComplete, JobPriority completionPriority)
+    {
+        IOHandle ioBatch = std::make_shared<IOBatch>();
+        ioBatch->m_Requests = std::move(requests);
+        ioBatch->m_OnComplete = std::move(onComplete);
+        ioBatch->m_CompletionPriority = completionPriority;
+
+        const uint32_t requestCount = static_cast<uint32_t>(ioBatch->m_Requests.size());
+        if (requestCount == 0)
+        {
+            ioBatch->m_RequestsRemaining.store(1, std::memory_order_relaxed);
+            CompleteRequest(ioBatch);
+            return ioBatch;
+        }
+
+        // Queue requests grouped by file and in ascending offsets, so IO threads reuse open files and read sequentially wherever possible.
+        std::vector<uint32_t> requestOrder(requestCount);
+        for (uint32_t i = 0; i < requestCount; i++)
+        {
+            requestOrder[i] = i;
+        }
+
+        std::sort(requestOrder.begin(), requestOrder.end(), [&ioBatch](uint32_t a, uint32_t b)
+        {
+            const IOReadRequest& requestA = ioBatch->m_Requests[a];
+            const IOReadRequest& requestB = ioBatch->m_Requests[b];
+            return requestA.m_FilePath != requestB.m_FilePath ? requestA.m_FilePath < requestB.m_FilePath : requestA.m_Offset < requestB.m_Offset;
+        });
+
+        ioBatch->m_RequestsRemaining.store(requestCount, std::memory_order_relaxed);
+        bool isQueued = false;
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            if (m_IsRunning)
+            {
+                for (const uint32_t requestIndex : requestOrder)
+                {
+                    m_PendingReads.push_back({ ioBatch, requestIndex });
+                }
+                m_PendingReadCount.fetch_add(requestCount, std::memory_order_relaxed);
+                isQueued = true;
+            }
+        }
+
+        if (!isQueued)
+        {
+            AURORA_WARNING(LogLayer::Engine, "Read batch submitted while the IO Service isn't running. Cancelling.");
+            for (IOReadRequest& request : ioBatch->m_Requests)
+            {
+                request.m_Status = IOStatus::Cancelled;
+                CompleteRequest(ioBatch);
+            }
+            return ioBatch;
+        }
+
+        m_QueueCondition.notify_all();
+        return ioBatch;
+    }
+
+    IOHandle IOService::ReadFile(const std::string& filePath, std::vector<uint8_t>* destination, IOCompletionFunction onComplete, JobPriority completionPriority)
+    {
+        std::vector<IOReadRequest> requests(1);
+        requests[0].m_FilePath = filePath;
+        requests[0].m_DestinationBuffer = destination;
+
+        return SubmitReads(std::move(requests), std::move(onComplete), completionPriority);
+    }
+
+    bool IOService::IsComplete(const IOHandle& ioHandle) const
+    {
+        if (!ioHandle || ioHandle->m_State.load(std::memory_order_acquire) != IOBatch::State_Read)
+        {
+            return !ioHandle;
+        }
+
+        return !ioHandle->m_CompletionJob.IsValid() || m_Threading == nullptr || m_Threading->IsComplete(ioHandle->m_CompletionJob);
+    }
+
+    void IOService::Wait(const IOHandle& ioHandle)
+    {
+        if (!ioHandle)
+        {
+            return;
+        }
+
+        // The reads themselves can't be helped along, so simply sleep until the last one finishes.
+        AddressWait::Wait(ioHandle->m_State, IOBatch::State_Reading);
+
+        if (ioHandle->m_CompletionJob.IsValid() && m_Threading)
+        {
+            m_Threading->Wait(ioHandle->m_CompletionJob);
+        }
+    }
+
+    void IOService::IOThreadLoop(uint32_t threadIndex)
+    {
+        IOFile file;
+
+        while (true)
+        {
+            PendingRead pendingRead;
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                if (m_PendingReads.empty())
+                {
+                    file.Close(); // Don't hold on to files while idle, which would prevent them from being written to or deleted on some platforms.
+                    m_QueueCondition.wait(lock, [this]() { return !m_PendingReads.empty() || !m_IsRunning; });
+                }
+
+                if (!m_IsRunning)
+                {
+                    return;
+                }
+
+                pendingRead = std::move(m_PendingReads.front());
+                m_PendingReads.pop_front();
+            }
+
+            IOReadRequest& request = pendingRead.m_Batch->m_Requests[pendingRead.m_RequestIndex];
+            {
+                AURORA_PROFILE_SCOPE("IO Read");
+                ServiceRequest(file, request);
+            }
+
+            m_BytesReadTotal.fetch_add(request.m_BytesRead, std::memory_order_relaxed);
+            m_PendingReadCount.fetch_sub(1, std::memory_order_relaxed);
+            CompleteRequest(pendingRead.m_Batch);
+        }
+    }
+
+    void IOService::CompleteRequest(const IOHandle& ioBatch)
+    {
+        if (ioBatch->m_RequestsRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+
+        // We finished the batch's last request. The completion job holds its own reference, keeping the batch alive even if every handle is dropped.
+        if (ioBatch->m_OnComplete && m_Threading)
+        {
+            AURORA_JOB_LABEL("IO Completion");
+            ioBatch->m_CompletionJob = m_Threading->Execute([ioBatch](JobInformation jobInformation)
+            {
+                ioBatch->m_OnComplete(*ioBatch);
+            }, {}, ioBatch->m_CompletionPriority);
+        }
+
+        ioBatch->m_State.store(IOBatch::State_Read, std::memory_order_release);
+        AddressWait::WakeAll(ioBatch->m_State);
+    }
+
+    void IOService::BatchReadUnitTest()
+    {
+        // Write out a file of known contents, then read it back in pieces spread across a batch.
+        const std::string filePath = "IOServiceUnitTest.bin";
+        constexpr uint32_t chunkCount = 64;
+        constexpr uint32_t chunkSize = 64 * 1024;
+
+        std::vector<uint32_t> fileData(chunkCount * chunkSize / sizeof(uint32_t));
+        for (uint32_t i = 0; i < fileData.size(); i++)
+        {
+            fileData[i] = i * 2654435761u;
+        }
+
+        {
+            std::ofstream file(filePath, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(fileData.data()), fileData.size() * sizeof(uint32_t));
+        }
+
+        // Every request reads into a buffer of its own, so that data landing in the wrong request's destination can't go unnoticed.
+        std::vector<std::vector<uint8_t>> chunkData(chunkCount, std::vector<uint8_t>(chunkSize));
+        std::vector<uint8_t> wholeFile;
+        std::vector<uint8_t> missingFile;
+        std::vector<IOReadRequest> requests(chunkCount + 2);
+        for (uint32_t i = 0; i < chunkCount; i++)
+        {
+            const uint32_t chunkIndex = (i * 37) % chunkCount; // Out of order, to exercise our sorting.
+            requests[i].m_FilePath = filePath;
+            requests[i].m_Offset = static_cast<uint64_t>(chunkIndex) * chunkSize;
+            requests[i].m_Size = chunkSize;
+            requests[i].m_Destination = chunkData[chunkIndex].data();
+        }
+
+        requests[chunkCount].m_FilePath = filePath;
+        requests[chunkCount].m_DestinationBuffer = &wholeFile;
+        requests[chunkCount + 1].m_FilePath = "IOServiceUnitTestMissing.bin";
+        requests[chunkCount + 1].m_Size = 16;
+        requests[chunkCount + 1].m_DestinationBuffer = &missingFile;
+        requests[chunkCount + 1].m_IsMissingFileExpected = true;
+
+        std::atomic<bool> isCompletionRun{ false };
+        std::atomic<bool> isCompletionOffMainThread{ false };
+        const std::thread::id mainThreadID = std::this_thread::get_id();
+
+        const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+        IOHandle ioHandle = SubmitReads(std::move(requests), [&isCompletionRun, &isCompletionOffMainThread, mainThreadID](IOBatch& ioBatch)
+        {
+            isCompletionOffMainThread = std::this_thread::get_id() != mainThreadID;
+            isCompletionRun = true;
+        }, JobPriority::Background);
+        Wait(ioHandle);
+        const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        const size_t fileSize = fileData.size() * sizeof(uint32_t);
+        const uint8_t* fileBytes = reinterpret_cast<const uint8_t*>(fileData.data());
+
+        bool isSuccessful = isCompletionRun.load();
+        for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+        {
+            isSuccessful = isSuccessful && std::memcmp(chunkData[chunkIndex].data(), fileBytes + static_cast<size_t>(chunkIndex) * chunkSize, chunkSize) == 0;
+        }
+        isSuccessful = isSuccessful && wholeFile.size() == fileSize && std::memcmp(wholeFile.data(), fileBytes, fileSize) == 0;
+        isSuccessful = isSuccessful && missingFile.empty();
+        for (uint32_t i = 0; i < chunkCount + 1; i++)
+        {
+            isSuccessful = isSuccessful && ioHandle->m_Requests[i].m_Status == IOStatus::Success;
+        }
+        isSuccessful = isSuccessful && ioHandle->m_Requests[chunkCount + 1].m_Status == IOStatus::FileNotFound && !ioHandle->IsSuccessful();
+
+        std::remove(filePath.c_str());
+
+        AURORA_INFO(LogLayer::Engine, "IO Service: Read %u requests (%u KB) across %u IO threads in %.3fms. Completion %s the main thread.", chunkCount + 2, static_cast<uint32_t>(fileSize * 2 / 1024),
+                    GetIOThreadCount(), milliseconds, isCompletionOffMainThread ? "ran off" : "ran on");
+        if (isSuccessful)
+        {
+            AURORA_INFO(LogLayer::Engine, "IO Service Unit Test Passed.");
+        }
+        else
+        {
+            AURORA_ERROR(LogLayer::Engine, "IO Service Unit Test Failed.");
+        }
+    }
+}
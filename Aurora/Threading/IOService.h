@@ -0,0 +1,132 @@
+#pragma once
+#include "ISubsystem.h"
+#include "Threading.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* == IO Service ==
+
+    Reading a file blocks the calling thread for as long as the disk takes. Doing so on a frame worker stalls whatever Dispatch group it was part of, and even background
+    workers are better spent decoding and importing than waiting on the disk. The IO Service thus owns a small pool of its own threads, which do nothing but read. Their
+    count is ThreadingConfiguration::m_IOWorkerCount, as given to the Engine's constructor.
+
+    Reads are submitted in batches of requests (path, offset, size, destination). The requests of a batch are spread across the IO threads, ordered by file and offset so
+    consecutive reads of the same file reuse its handle and run sequentially. Once every request of a batch has finished, its completion function is posted as a job onto
+    the Threading subsystem with the priority of your choosing - which is where any parsing or decoding of the data belongs.
+
+    Destinations must stay alive and untouched until the batch completes. Request results (status and bytes read) are written into the batch's own copy of each request,
+    which the completion function receives.
+
+    Each IO thread currently blocks on a positional read (pread/ReadFile with an offset) per request. A completion based backend such as io_uring or IOCP could replace the
+    IO threads entirely without changing this interface.
+*/
+
+namespace Aurora
+{
+    class IOService;
+
+    enum class IOStatus : uint32_t
+    {
+        Pending,
+        Success,
+        FileNotFound,
+        ReadError,   // The file could not be read, or ended before the requested size could be read. Bytes read up until then are kept.
+        Cancelled    // The service shut down before the request was serviced.
+    };
+
+    static constexpr uint64_t g_IOReadToEnd = ~0ull;
+
+    struct IOReadRequest
+    {
+        std::string m_FilePath;
+        uint64_t m_Offset = 0;
+        uint64_t m_Size = g_IOReadToEnd;                        // Bytes to read. g_IOReadToEnd reads everything past m_Offset.
+        void* m_Destination = nullptr;                          // Must hold m_Size bytes. Leave null to read into m_DestinationBuffer instead.
+        std::vector<uint8_t>* m_DestinationBuffer = nullptr;    // Resized to fit the read. Handy when the size isn't known up front.
+        bool m_IsMissingFileExpected = false;                   // Reports a missing file through m_Status alone, rather than logging an error. For files that may not exist.
+
+        // Written by the service.
+        IOStatus m_Status = IOStatus::Pending;
+        uint64_t m_BytesRead = 0;
+    };
+
+    struct IOBatch;
+    using IOCompletionFunction = InlineFunction<void(IOBatch&), 64>;
+
+    struct IOBatch
+    {
+        std::vector<IOReadRequest> m_Requests;
+        IOCompletionFunction m_OnComplete;
+        JobPriority m_CompletionPriority = JobPriority::High;
+
+        bool IsSuccessful() const; // Whether every request of the batch succeeded.
+
+    private:
+        friend class IOService;
+
+        enum State : uint32_t
+        {
+            State_Reading,
+            State_Read // Every request has finished, and the completion job (if any) has been posted.
+        };
+
+        std::atomic<uint32_t> m_RequestsRemaining{ 0 };
+        std::atomic<uint32_t> m_State{ State_Reading };
+        JobHandle m_CompletionJob; // Written before m_State moves to State_Read.
+    };
+
+    // Keeps its batch alive for as long as it is held. The service holds its own reference until the batch completes.
+    using IOHandle = std::shared_ptr<IOBatch>;
+
+    class IOService : public ISubsystem
+    {
+    public:
+        IOService(EngineContext* engineContext);
+
+        bool Initialize() override; // Spawns our IO threads.
+        void Shutdown() override;   // Cancels pending requests and joins our IO threads.
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_None, false }; }
+
+        // Queues a batch of reads. onComplete is executed as a job of the given priority once every request has finished, successfully or not.
+        IOHandle SubmitReads(std::vector<IOReadRequest> requests, IOCompletionFunction onComplete = nullptr, JobPriority completionPriority = JobPriority::High);
+        IOHandle ReadFile(const std::string& filePath, std::vector<uint8_t>* destination, IOCompletionFunction onComplete = nullptr, JobPriority completionPriority = JobPriority::High); // Reads a whole file.
+
+        bool IsComplete(const IOHandle& ioHandle) const; // Whether the batch's reads and completion job have all finished.
+        void Wait(const IOHandle& ioHandle);             // Blocks until the batch's reads finish, then helps out with jobs until its completion job has run.
+
+        uint32_t GetIOThreadCount() const { return static_cast<uint32_t>(m_IOThreads.size()); }
+        uint32_t GetPendingReadCount() const { return m_PendingReadCount.load(std::memory_order_relaxed); }
+        uint64_t GetBytesReadTotal() const { return m_BytesReadTotal.load(std::memory_order_relaxed); }
+
+        void BatchReadUnitTest();
+
+    private:
+        struct PendingRead
+        {
+            IOHandle m_Batch;
+            uint32_t m_RequestIndex = 0;
+        };
+
+        void IOThreadLoop(uint32_t threadIndex);
+        void CompleteRequest(const IOHandle& ioBatch);
+
+    private:
+        Threading* m_Threading = nullptr;
+        std::vector<std::thread> m_IOThreads;
+
+        std::mutex m_QueueMutex;
+        std::condition_variable m_QueueCondition; // Used with m_QueueMutex. IO threads sleep on this while there is nothing to read.
+        std::deque<PendingRead> m_PendingReads;
+        bool m_IsRunning = false;                 // Guarded by m_QueueMutex.
+
+        std::atomic<uint32_t> m_PendingReadCount{ 0 };
+        std::atomic<uint64_t> m_BytesReadTotal{ 0 };
+    };
+}
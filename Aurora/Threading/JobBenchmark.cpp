@@ -0,0 +1,242 @@
+#include "Aurora.h"
+#include "JobBenchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace Aurora
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    static double ElapsedNanoseconds(const BenchmarkClock::time_point& startTime)
+    {
+        return std::chrono::duration<double, std::nano>(BenchmarkClock::now() - startTime).count();
+    }
+
+    // Runs the given measurement a number of times, returning every sample in ascending order.
+    template<typename Measurement>
+    static std::vector<double> Sample(uint32_t repetitions, Measurement&& measurement)
+    {
+        std::vector<double> samples(repetitions);
+        for (double& sample : samples)
+        {
+            sample = measurement();
+        }
+
+        std::sort(samples.begin(), samples.end());
+        return samples;
+    }
+
+    void JobBenchmark::Run(uint32_t maxWorkerCount)
+    {
+        const uint32_t hardwareWorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        maxWorkerCount = maxWorkerCount == 0 ? hardwareWorkerCount : maxWorkerCount;
+
+        m_ComputeOutput.assign(m_ComputeItemCount, 0.0f);
+        m_MemoryInput.resize(m_MemoryItemCount);
+        m_MemoryOutput.assign(m_MemoryItemCount, 0);
+        for (uint32_t i = 0; i < m_MemoryItemCount; i++)
+        {
+            m_MemoryInput[i] = i;
+        }
+
+        m_Results.clear();
+        for (uint32_t workerCount = 1; workerCount <= maxWorkerCount; workerCount = (workerCount == maxWorkerCount) ? workerCount + 1 : std::min(workerCount * 2, maxWorkerCount))
+        {
+            JobBenchmarkResult result = Measure(workerCount);
+            if (!m_Results.empty())
+            {
+                result.m_ComputeSpeedup = m_Results.front().m_ComputeMilliseconds / result.m_ComputeMilliseconds;
+                result.m_MemorySpeedup = m_Results.front().m_MemoryMilliseconds / result.m_MemoryMilliseconds;
+            }
+
+            AURORA_INFO(LogLayer::Engine, "Job Benchmark (%u Workers): Execute %.1fns/job, Dispatch %.1fns/job, Fan-Out %.1fus (P99 %.1fus), Nested %.3fms, Compute %.3fms (%.2fx), Memory %.2fGB/s (%.2fx).",
+                        workerCount, result.m_EmptyExecuteNanoseconds, result.m_EmptyDispatchNanoseconds, result.m_FanOutMedianMicroseconds, result.m_FanOutP99Microseconds,
+                        result.m_NestedDispatchMilliseconds, result.m_ComputeMilliseconds, result.m_ComputeSpeedup, result.m_MemoryGigabytesPerSecond, result.m_MemorySpeedup);
+
+            m_Results.push_back(result);
+        }
+
+        // Don't hold on to our buffers between runs.
+        m_ComputeOutput = std::vector<float>();
+        m_MemoryInput = std::vector<uint32_t>();
+        m_MemoryOutput = std::vector<uint32_t>();
+    }
+
+    JobBenchmarkResult JobBenchmark::Measure(uint32_t workerCount)
+    {
+        // A standalone instance, sized as requested. Pinning is left off as the live subsystem's workers already occupy our physical cores.
+        ThreadingConfiguration configuration;
+        configuration.m_FrameWorkerCount = workerCount;
+        configuration.m_BackgroundWorkerCount = 0;
+        configuration.m_PinWorkersToCores = false;
+
+        Threading threading(nullptr);
+        threading.Initialize(configuration);
+        AURORA_JOB_LABEL("Job Benchmark");
+
+        JobBenchmarkResult result;
+        result.m_WorkerCount = workerCount;
+
+        // Empty Job Overhead
+        result.m_EmptyExecuteNanoseconds = Sample(m_Repetitions, [&threading]()
+        {
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            for (uint32_t i = 0; i < m_EmptyJobCount; i++)
+            {
+                threading.Execute([](JobInformation jobInformation) {});
+            }
+            threading.Wait();
+
+            return ElapsedNanoseconds(startTime) / m_EmptyJobCount;
+        }).front();
+
+        result.m_EmptyDispatchNanoseconds = Sample(m_Repetitions, [&threading]()
+        {
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            threading.Wait(threading.Dispatch(m_EmptyJobCount, 1, [](JobInformation jobInformation) {}));
+
+            return ElapsedNanoseconds(startTime) / m_EmptyJobCount;
+        }).front();
+
+        // Fan-Out/Fan-In - a few jobs per thread, followed by a continuation depending on all of them.
+        const uint32_t fanOutJobCount = (workerCount + 1) * 4;
+        const std::vector<double> fanOutSamples = Sample(m_FanOutSampleCount, [&threading, fanOutJobCount]()
+        {
+            std::atomic<int64_t> fanInTime{ 0 };
+
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            const JobHandle fanOutHandle = threading.Dispatch(fanOutJobCount, 1, [](JobInformation jobInformation)
+            {
+                volatile uint32_t work = 0;
+                for (uint32_t i = 0; i < 256; i++) { work = work + i; }
+            });
+            const JobHandle fanInHandle = threading.Execute([&fanInTime](JobInformation jobInformation)
+            {
+                fanInTime.store(BenchmarkClock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            }, { fanOutHandle });
+            threading.Wait(fanInHandle);
+
+            const BenchmarkClock::time_point endTime{ BenchmarkClock::duration(fanInTime.load(std::memory_order_relaxed)) };
+            return std::chrono::duration<double, std::micro>(endTime - startTime).count();
+        });
+
+        result.m_FanOutMedianMicroseconds = fanOutSamples[fanOutSamples.size() / 2];
+        result.m_FanOutP99Microseconds = fanOutSamples[(fanOutSamples.size() * 99) / 100];
+
+        // Nested Dispatch
+        result.m_NestedDispatchMilliseconds = Sample(m_Repetitions, [&threading]()
+        {
+            std::atomic<uint32_t> innerJobCount{ 0 };
+
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            threading.Wait(threading.Dispatch(m_NestedJobCount, 1, [&threading, &innerJobCount](JobInformation jobInformation)
+            {
+                threading.Wait(threading.Dispatch(m_NestedJobCount, 1, [&innerJobCount](JobInformation jobInformation)
+                {
+                    volatile float work = 1.0f;
+                    for (uint32_t i = 0; i < 1024; i++) { work = work * 1.0001f; }
+                    innerJobCount.fetch_add(1, std::memory_order_relaxed);
+                }));
+            }));
+            const double milliseconds = ElapsedNanoseconds(startTime) / 1e6;
+
+            if (innerJobCount.load() != m_NestedJobCount * m_NestedJobCount)
+            {
+                AURORA_ERROR(LogLayer::Engine, "Job Benchmark: Nested dispatch ran %u of %u inner jobs.", innerJobCount.load(), m_NestedJobCount * m_NestedJobCount);
+            }
+
+            return milliseconds;
+        }).front();
+
+        // Compute Bound - a long dependency chain of arithmetic per item, touching a single float of memory.
+        float* computeOutput = m_ComputeOutput.data();
+        result.m_ComputeMilliseconds = Sample(m_Repetitions, [&threading, computeOutput]()
+        {
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            threading.ParallelForRange(m_ComputeItemCount, [computeOutput](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    float value = static_cast<float>(i);
+                    for (uint32_t iteration = 0; iteration < 256; iteration++)
+                    {
+                        value = std::sqrt(value * 1.0001f + 1.0f);
+                    }
+                    computeOutput[i] = value;
+                }
+            });
+
+            return ElapsedNanoseconds(startTime) / 1e6;
+        }).front();
+        result.m_ComputeItemsPerSecond = m_ComputeItemCount / (result.m_ComputeMilliseconds / 1e3);
+
+        // Memory Bound - a single cheap operation per element, streaming through buffers far larger than our caches.
+        const uint32_t* memoryInput = m_MemoryInput.data();
+        uint32_t* memoryOutput = m_MemoryOutput.data();
+        result.m_MemoryMilliseconds = Sample(m_Repetitions, [&threading, memoryInput, memoryOutput]()
+        {
+            const BenchmarkClock::time_point startTime = BenchmarkClock::now();
+            threading.ParallelForRange(m_MemoryItemCount, [memoryInput, memoryOutput](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    memoryOutput[i] = memoryInput[i] * 3 + 1;
+                }
+            });
+
+            return ElapsedNanoseconds(startTime) / 1e6;
+        }).front();
+        result.m_MemoryGigabytesPerSecond = (2.0 * sizeof(uint32_t) * m_MemoryItemCount) / (result.m_MemoryMilliseconds / 1e3) / 1e9;
+
+        threading.Shutdown();
+        return result;
+    }
+
+    bool JobBenchmark::WriteJson(const std::string& filePath) const
+    {
+        std::ofstream outputStream(filePath);
+        if (!outputStream.is_open())
+        {
+            AURORA_ERROR(LogLayer::Engine, "Failed to open \"%s\" for writing job benchmark results.", filePath.c_str());
+            return false;
+        }
+
+        outputStream << std::fixed << std::setprecision(3);
+        outputStream << "{\n";
+        outputStream << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+        outputStream << "  \"repetitions\": " << m_Repetitions << ",\n";
+        outputStream << "  \"empty_job_count\": " << m_EmptyJobCount << ",\n";
+        outputStream << "  \"compute_item_count\": " << m_ComputeItemCount << ",\n";
+        outputStream << "  \"memory_item_count\": " << m_MemoryItemCount << ",\n";
+        outputStream << "  \"runs\": [\n";
+
+        for (size_t i = 0; i < m_Results.size(); i++)
+        {
+            const JobBenchmarkResult& result = m_Results[i];
+            outputStream << "    {\n";
+            outputStream << "      \"workers\": " << result.m_WorkerCount << ",\n";
+            outputStream << "      \"empty_execute_ns\": " << result.m_EmptyExecuteNanoseconds << ",\n";
+            outputStream << "      \"empty_dispatch_ns\": " << result.m_EmptyDispatchNanoseconds << ",\n";
+            outputStream << "      \"fan_out_median_us\": " << result.m_FanOutMedianMicroseconds << ",\n";
+            outputStream << "      \"fan_out_p99_us\": " << result.m_FanOutP99Microseconds << ",\n";
+            outputStream << "      \"nested_dispatch_ms\": " << result.m_NestedDispatchMilliseconds << ",\n";
+            outputStream << "      \"compute_ms\": " << result.m_ComputeMilliseconds << ",\n";
+            outputStream << "      \"compute_items_per_second\": " << result.m_ComputeItemsPerSecond << ",\n";
+            outputStream << "      \"compute_speedup\": " << result.m_ComputeSpeedup << ",\n";
+            outputStream << "      \"memory_ms\": " << result.m_MemoryMilliseconds << ",\n";
+            outputStream << "      \"memory_gb_per_second\": " << result.m_MemoryGigabytesPerSecond << ",\n";
+            outputStream << "      \"memory_speedup\": " << result.m_MemorySpeedup << "\n";
+            outputStream << "    }" << (i + 1 < m_Results.size() ? "," : "") << "\n";
+        }
+
+        outputStream << "  ]\n";
+        outputStream << "}\n";
+
+        AURORA_INFO(LogLayer::Engine, "Job benchmark results written to \"%s\".", filePath.c_str());
+        return true;
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* == Job Benchmark ==
+
+    Measures how the job system scales, so regressions in Threading show up as numbers rather than anecdotes. For each worker count (1, 2, 4... up to every hardware thread
+    but the main thread's), we spin up a standalone Threading instance with that many frame workers and measure:
+
+    - Empty Job Overhead: The cost per job of submitting and completing jobs that do nothing, both as individual Executes and as a single large Dispatch.
+    - Fan-Out/Fan-In Latency: The time from dispatching a burst of small jobs until a continuation depending on all of them runs.
+    - Nested Dispatch: Jobs that dispatch and wait on jobs of their own, which exercises helping while waiting.
+    - Compute Bound Throughput: Arithmetic heavy work that should scale with every added core.
+    - Memory Bound Throughput: Streaming through a buffer much larger than our caches, which flattens out once memory bandwidth is saturated.
+
+    Each measurement is repeated and the best (throughput) or median (latency) repetition kept. The calling thread participates in every run, as the main thread would.
+    Results are written out as JSON. The live Threading subsystem is left untouched, though its workers will compete for cores should they be busy meanwhile.
+*/
+
+namespace Aurora
+{
+    struct JobBenchmarkResult
+    {
+        uint32_t m_WorkerCount = 0;
+
+        double m_EmptyExecuteNanoseconds = 0.0;  // Per Execute call.
+        double m_EmptyDispatchNanoseconds = 0.0; // Per job of a single Dispatch.
+
+        double m_FanOutMedianMicroseconds = 0.0;
+        double m_FanOutP99Microseconds = 0.0;
+
+        double m_NestedDispatchMilliseconds = 0.0;
+
+        double m_ComputeMilliseconds = 0.0;
+        double m_ComputeItemsPerSecond = 0.0;
+        double m_ComputeSpeedup = 1.0;           // Relative to our first (single worker) run.
+
+        double m_MemoryMilliseconds = 0.0;
+        double m_MemoryGigabytesPerSecond = 0.0;
+        double m_MemorySpeedup = 1.0;
+    };
+
+    class JobBenchmark
+    {
+    public:
+        void Run(uint32_t maxWorkerCount = 0); // 0 benchmarks up to every hardware thread but the calling one.
+        bool WriteJson(const std::string& filePath) const;
+
+        const std::vector<JobBenchmarkResult>& GetResults() const { return m_Results; }
+
+    private:
+        JobBenchmarkResult Measure(uint32_t workerCount);
+
+    private:
+        static constexpr uint32_t m_Repetitions = 5;
+        static constexpr uint32_t m_EmptyJobCount = 1 << 16;
+        static constexpr uint32_t m_FanOutSampleCount = 256;
+        static constexpr uint32_t m_NestedJobCount = 32;     // Outer jobs, each of which dispatches as many inner jobs.
+        static constexpr uint32_t m_ComputeItemCount = 1 << 18;
+        static constexpr uint32_t m_MemoryItemCount = 1 << 24; // 64MB in and out.
+
+        std::vector<JobBenchmarkResult> m_Results;
+        std::vector<float> m_ComputeOutput;
+        std::vector<uint32_t> m_MemoryInput;
+        std::vector<uint32_t> m_MemoryOutput;
+    };
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+    A move-only replacement for std::function that stores its callable inline in a fixed size buffer and never touches the heap. Callables that do not fit fail to compile
+    rather than silently allocating, which is exactly what we want on hot paths such as job submission.
+
+    If a job genuinely needs a large capture, capture a pointer (or a shared_ptr) to the data instead.
+*/
+
+namespace Aurora
+{
+    template<typename Signature, size_t capacity>
+    class InlineFunction;
+
+    template<typename ReturnType, typename... Arguments, size_t capacity>
+    class InlineFunction<ReturnType(Arguments...), capacity>
+    {
+    public:
+        InlineFunction() = default;
+        InlineFunction(std::nullptr_t) {}
+
+        template<typename Function, typename = typename std::enable_if<!std::is_same<typename std::decay<Function>::type, InlineFunction>::value>::type>
+        InlineFunction(Function&& function)
+        {
+            using FunctionType = typename std::decay<Function>::type;
+
+            static_assert(sizeof(FunctionType) <= capacity, "Callable is too large to be stored inline. Capture less, or capture a pointer to your data instead.");
+            static_assert(alignof(FunctionType) <= alignof(std::max_align_t), "Callable is over-aligned for inline storage.");
+            static_assert(std::is_nothrow_move_constructible<FunctionType>::value, "Callable must be nothrow move constructible.");
+
+            new (m_Storage) FunctionType(std::forward<Function>(function));
+            m_Operations = &Operations<FunctionType>::m_Table;
+        }
+
+        InlineFunction(InlineFunction&& otherFunction) noexcept
+        {
+            MoveFrom(otherFunction);
+        }
+
+        InlineFunction& operator=(InlineFunction&& otherFunction) noexcept
+        {
+            if (this != &otherFunction)
+            {
+                Reset();
+                MoveFrom(otherFunction);
+            }
+
+            return *this;
+        }
+
+        InlineFunction& operator=(std::nullptr_t)
+        {
+            Reset();
+            return *this;
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        ~InlineFunction()
+        {
+            Reset();
+        }
+
+        ReturnType operator()(Arguments... arguments) const
+        {
+            return m_Operations->m_Invoke(const_cast<unsigned char*>(m_Storage), std::forward<Arguments>(arguments)...);
+        }
+
+        explicit operator bool() const { return m_Operations != nullptr; }
+
+    private:
+        void Reset()
+        {
+            if (m_Operations)
+            {
+                m_Operations->m_Destroy(m_Storage);
+                m_Operations = nullptr;
+            }
+        }
+
+        void MoveFrom(InlineFunction& otherFunction)
+        {
+            if (otherFunction.m_Operations)
+            {
+                otherFunction.m_Operations->m_Move(m_Storage, otherFunction.m_Storage);
+                m_Operations = otherFunction.m_Operations;
+                otherFunction.Reset();
+            }
+        }
+
+        // A static table per callable type, so an InlineFunction only carries one pointer alongside its storage.
+        struct OperationTable
+        {
+            ReturnType (*m_Invoke)(void* storage, Arguments&&... arguments);
+            void (*m_Move)(void* destination, void* source);
+            void (*m_Destroy)(void* storage);
+        };
+
+        template<typename FunctionType>
+        struct Operations
+        {
+            static ReturnType Invoke(void* storage, Arguments&&... arguments)
+            {
+                return (*static_cast<FunctionType*>(storage))(std::forward<Arguments>(arguments)...);
+            }
+
+            static void Move(void* destination, void* source)
+            {
+                new (destination) FunctionType(std::move(*static_cast<FunctionType*>(source)));
+            }
+
+            static void Destroy(void* storage)
+            {
+                static_cast<FunctionType*>(storage)->~FunctionType();
+            }
+
+            static constexpr OperationTable m_Table = { &Invoke, &Move, &Destroy };
+        };
+
+    private:
+        alignas(std::max_align_t) unsigned char m_Storage[capacity];
+        const OperationTable* m_Operations = nullptr;
+    };
+}
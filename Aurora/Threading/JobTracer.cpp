@@ -0,0 +1,107 @@
+#include "Aurora.h"
+#include "JobTracer.h"
+#include <chrono>
+#include <string>
+
+namespace Aurora
+{
+    static thread_local const char* g_JobLabel = nullptr;
+
+    void JobTracer::Initialize(uint32_t threadCount)
+    {
+        m_BufferCount = threadCount + 1;
+        m_Buffers = std::make_unique<ThreadBuffer[]>(m_BufferCount);
+
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            m_Buffers[i].m_Events.reserve(1024);
+            m_Buffers[i].m_Lock.SetStatistics(&m_BufferLockStatistics);
+        }
+        m_FlushEvents.reserve(1024);
+    }
+
+    void JobTracer::Record(uint32_t threadIndex, const JobTraceEvent& traceEvent)
+    {
+        ThreadBuffer& buffer = m_Buffers[std::min(threadIndex, m_BufferCount - 1)];
+
+        buffer.m_Lock.Lock();
+        if (buffer.m_Events.size() < m_MaxEventsPerThread)
+        {
+            buffer.m_Events.push_back(traceEvent);
+        }
+        else
+        {
+            buffer.m_DroppedEventCount++;
+        }
+        buffer.m_Lock.Unlock();
+    }
+
+    void JobTracer::Flush()
+    {
+        const bool isSessionActive = Instrumentor::GetInstance().IsSessionActive();
+        m_FlushedEventCount = 0;
+        m_DroppedEventCount = 0;
+
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            ThreadBuffer& buffer = m_Buffers[i];
+
+            // Only hold the lock for the swap. Writing out to disk happens afterwards.
+            buffer.m_Lock.Lock();
+            buffer.m_Events.swap(m_FlushEvents);
+            m_DroppedEventCount += buffer.m_DroppedEventCount;
+            buffer.m_DroppedEventCount = 0;
+            buffer.m_Lock.Unlock();
+
+            m_FlushedEventCount += static_cast<uint32_t>(m_FlushEvents.size());
+
+            if (isSessionActive)
+            {
+                for (const JobTraceEvent& traceEvent : m_FlushEvents)
+                {
+                    const double startMicroseconds = traceEvent.m_StartTime / 1000.0;
+                    const double durationMicroseconds = (traceEvent.m_EndTime - traceEvent.m_StartTime) / 1000.0;
+
+                    std::string arguments;
+                    if (traceEvent.m_EnqueueTime != 0)
+                    {
+                        // Time spent waiting in a queue is what reveals scheduling gaps, hence we carry it along with each job.
+                        arguments = "\"group\":" + std::to_string(traceEvent.m_GroupID) + ",\"groups\":" + std::to_string(traceEvent.m_GroupCount) +
+                                    ",\"queued_us\":" + std::to_string((traceEvent.m_StartTime - traceEvent.m_EnqueueTime) / 1000.0);
+                    }
+
+                    Instrumentor::GetInstance().WriteEvent(traceEvent.m_Label ? traceEvent.m_Label : "Job", traceEvent.m_Category, startMicroseconds, durationMicroseconds, traceEvent.m_ThreadID, arguments);
+                }
+            }
+
+            m_FlushEvents.clear();
+        }
+    }
+
+    int64_t JobTracer::GetTimestamp()
+    {
+        // Same clock and epoch as InstrumentorTimer, so our events line up with profiled scopes.
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+    }
+
+    uint32_t JobTracer::GetThreadID()
+    {
+        static thread_local const uint32_t threadID = Instrumentor::GetThreadID();
+        return threadID;
+    }
+
+    JobLabelScope::JobLabelScope(const char* label) : m_PreviousLabel(g_JobLabel)
+    {
+        g_JobLabel = label;
+    }
+
+    JobLabelScope::~JobLabelScope()
+    {
+        g_JobLabel = m_PreviousLabel;
+    }
+
+    const char* JobLabelScope::GetCurrentLabel()
+    {
+        return g_JobLabel;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Spinlock.h"
+
+/* == Job Tracer ==
+
+    Records a timeline of the job system: when each job group was queued, which thread ran it and for how long, as well as when workers went to sleep. Events are written into
+    per-thread buffers (each guarded by its own, practically uncontended spinlock) and flushed once per frame into the active Instrumentor session, so they show up right
+    next to our AURORA_PROFILE_SCOPE blocks in chrome://tracing or Perfetto.
+
+    Tracing is disabled by default and costs a single relaxed load per job while off. Label submissions with AURORA_JOB_LABEL, which applies to every Dispatch/Execute made
+    by the calling thread within the enclosing scope. Labels must be string literals (or otherwise outlive the trace).
+*/
+
+namespace Aurora
+{
+    struct JobTraceEvent
+    {
+        const char* m_Label = nullptr;
+        const char* m_Category = nullptr;
+        uint32_t m_ThreadID = 0;
+        uint32_t m_GroupID = 0;
+        uint32_t m_GroupCount = 0;
+        int64_t m_EnqueueTime = 0; // Nanoseconds. Zero for events that were never queued, such as sleeps.
+        int64_t m_StartTime = 0;
+        int64_t m_EndTime = 0;
+    };
+
+    class JobTracer
+    {
+    public:
+        void Initialize(uint32_t threadCount); // One buffer per participating thread, plus one shared by all threads outside of the job system.
+
+        void SetEnabled(bool isEnabled) { m_IsEnabled.store(isEnabled, std::memory_order_relaxed); }
+        bool IsEnabled() const { return m_IsEnabled.load(std::memory_order_relaxed); }
+
+        void Record(uint32_t threadIndex, const JobTraceEvent& traceEvent); // Pass the calling thread's queue index, or an out of range index for outside threads.
+        void Flush();                                                        // Writes all buffered events into the active Instrumentor session, or discards them if there is none.
+
+        uint32_t GetFlushedEventCount() const { return m_FlushedEventCount; } // Events gathered by the last flush.
+        uint32_t GetDroppedEventCount() const { return m_DroppedEventCount; } // Events lost to full buffers prior to the last flush.
+
+        static int64_t GetTimestamp();
+        static uint32_t GetThreadID(); // Matches the thread IDs used by the Instrumentor.
+
+    private:
+        static constexpr uint32_t m_MaxEventsPerThread = 1 << 16; // Bounds our memory should nobody flush, such as when running without a frame loop.
+
+        struct alignas(64) ThreadBuffer
+        {
+            Spinlock m_Lock;
+            std::vector<JobTraceEvent> m_Events;
+            uint32_t m_DroppedEventCount = 0;
+        };
+
+        std::atomic<bool> m_IsEnabled{ false };
+        SpinlockStatistics m_BufferLockStatistics{ "Job Trace Buffers" };
+        std::unique_ptr<ThreadBuffer[]> m_Buffers;
+        uint32_t m_BufferCount = 0;
+        std::vector<JobTraceEvent> m_FlushEvents; // Swapped with each thread buffer upon flushing, so neither side reallocates in steady state.
+        uint32_t m_FlushedEventCount = 0;
+        uint32_t m_DroppedEventCount = 0;
+    };
+
+    // Labels every submission made by the calling thread within its scope. Scopes nest.
+    class JobLabelScope
+    {
+    public:
+        JobLabelScope(const char* label);
+        ~JobLabelScope();
+
+        static const char* GetCurrentLabel();
+
+    private:
+        const char* m_PreviousLabel = nullptr;
+    };
+
+    #define AURORA_JOB_LABEL(label) ::Aurora::JobLabelScope jobLabel##__LINE__(label)
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/*
+    A lock-free, bounded, multi-producer/multi-consumer queue, based on Dmitry Vyukov's design (https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue).
+    It shares RingBuffer's interface and can be used in its place.
+
+    Every cell carries a sequence number which tells producers and consumers whether it is ready for them. A thread claims a position with a single CAS on the enqueue or dequeue
+    index, and then publishes its write through the cell's sequence number. There is no lock, so a thread that is preempted mid-operation only delays the consumer of its own cell
+    rather than every other thread.
+*/
+
+namespace Aurora
+{
+    template<typename T, size_t capacity>
+    class MPMCQueue
+    {
+        static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "MPMCQueue capacity must be a power of two.");
+
+    public:
+        MPMCQueue()
+        {
+            for (size_t i = 0; i < capacity; i++)
+            {
+                m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MPMCQueue(const MPMCQueue&) = delete;
+        MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+        // Pushes an item to the back of the queue. Returns true if successful, returns false if there is a lack of space.
+        inline bool push_back(const T& item)
+        {
+            Cell* cell = nullptr;
+            size_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                cell = &m_Cells[position & m_Mask];
+                const size_t sequence = cell->m_Sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                if (difference == 0)
+                {
+                    // The cell is free for this position. Try to claim it.
+                    if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false; // The cell still holds an item from the previous lap - we're full.
+                }
+                else
+                {
+                    position = m_EnqueuePosition.load(std::memory_order_relaxed); // Another producer got here first.
+                }
+            }
+
+            cell->m_Data = item;
+            cell->m_Sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Retrieves an item from the front of the queue if there is any. Returns true if successful, returns false if no items are avaliable.
+        inline bool pop_front(T& item)
+        {
+            Cell* cell = nullptr;
+            size_t position = m_DequeuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                cell = &m_Cells[position & m_Mask];
+                const size_t sequence = cell->m_Sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+                if (difference == 0)
+                {
+                    if (m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false; // Nothing has been published to this cell yet - we're empty.
+                }
+                else
+                {
+                    position = m_DequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = std::move(cell->m_Data);
+            cell->m_Sequence.store(position + m_Mask + 1, std::memory_order_release); // Hand the cell over to the producer of the next lap.
+            return true;
+        }
+
+        // Retrieves the approximate number of items in the queue. Exact only while no other thread is pushing or popping.
+        inline int size() const
+        {
+            const size_t enqueuePosition = m_EnqueuePosition.load(std::memory_order_acquire);
+            const size_t dequeuePosition = m_DequeuePosition.load(std::memory_order_acquire);
+            return enqueuePosition > dequeuePosition ? static_cast<int>(enqueuePosition - dequeuePosition) : 0;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> m_Sequence;
+            T m_Data;
+        };
+
+        static constexpr size_t m_Mask = capacity - 1;
+
+        // Producers and consumers each hammer their own index. Keep them and the cells on seperate cache lines.
+        alignas(64) Cell m_Cells[capacity];
+        alignas(64) std::atomic<size_t> m_EnqueuePosition{ 0 };
+        alignas(64) std::atomic<size_t> m_DequeuePosition{ 0 };
+    };
+}
@@ -45,7 +45,11 @@ namespace Aurora
         // Retrieves the current number of tasks in the queue.
         inline int size()
         {
-            return m_Tail - m_Head;
+            m_Lock.Lock();
+            const size_t count = (m_Head + capacity - m_Tail) % capacity;
+            m_Lock.Unlock();
+
+            return static_cast<int>(count);
         }
 
     private:
@@ -1,35 +1,244 @@
 #pragma once
 #include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <chrono>
+#include "AddressWait.h"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #include <x86intrin.h>
+#endif
 
 /*
-    Spinlocks allow threads to simply wait in a loop while repeatedly checking if a lock is released. As the thread remains active and is simply not performing tasks, we're practically 
-    "busy waiting". The difference to a mutex is that this doesn't let the thread yield, but instead spin (loop) on an atomic flag until the spinlock can be released, during which execution 
+    Spinlocks allow threads to simply wait in a loop while repeatedly checking if a lock is released. As the thread remains active and is simply not performing tasks, we're practically
+    "busy waiting". The difference to a mutex is that this doesn't let the thread yield, but instead spin (loop) on an atomic flag until the spinlock can be released, during which execution
     will proceed.
 
+    Naive spinning hurts the very thread holding the lock - every failed test_and_set pulls the cache line over to the spinning core, and a spinning hyperthread steals execution
+    resources from its sibling. Hence, our lock adapts in three stages:
+
+    - Test and test-and-set: Waiters spin on a plain load, which is served from their own cache, and only attempt the atomic exchange once the lock looks free.
+    - Exponential backoff: Between attempts, waiters pause for exponentially longer (up to a limit) using the CPU's pause instruction.
+    - Parking: Once the spin budget runs out, waiters sleep on the lock word itself through AddressWait, which maps onto a futex on Linux and WaitOnAddress on Windows.
+      Unlock only makes a system call if somebody is actually parked.
+
+    The lock word is 0 (unlocked), 1 (locked) or 2 (locked, and there may be parked waiters), following Drepper's "Futexes Are Tricky".
+
+    Locks can optionally report into a SpinlockStatistics (shared by any number of locks), which counts acquisitions, contended acquisitions, spin cycles and parks while
+    statistics are enabled. Every statistics object registers itself by name so the ThreadTracker widget can list the hottest locks.
+
     For more information: https://stackoverflow.com/questions/1957398/what-exactly-are-spin-locks
 */
 
 namespace Aurora
 {
+    struct SpinlockStatistics
+    {
+        SpinlockStatistics(const char* name) : m_Name(name)
+        {
+            std::lock_guard<std::mutex> lock(GetRegistryMutex());
+            GetRegistry().push_back(this);
+        }
+
+        ~SpinlockStatistics()
+        {
+            std::lock_guard<std::mutex> lock(GetRegistryMutex());
+            std::vector<SpinlockStatistics*>& registry = GetRegistry();
+            registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+        }
+
+        SpinlockStatistics(const SpinlockStatistics&) = delete;
+        SpinlockStatistics& operator=(const SpinlockStatistics&) = delete;
+
+        void Reset()
+        {
+            m_Acquisitions.store(0, std::memory_order_relaxed);
+            m_ContendedAcquisitions.store(0, std::memory_order_relaxed);
+            m_SpinCycles.store(0, std::memory_order_relaxed);
+            m_ParkCount.store(0, std::memory_order_relaxed);
+        }
+
+        // Counting costs a shared atomic increment per acquisition, hence it is off unless somebody is looking.
+        static void SetEnabled(bool isEnabled) { GetEnabledFlag().store(isEnabled, std::memory_order_relaxed); }
+        static bool IsEnabled() { return GetEnabledFlag().load(std::memory_order_relaxed); }
+
+        // Calls function(const SpinlockStatistics&) for every registered statistics object.
+        template<typename Function>
+        static void ForEach(Function&& function)
+        {
+            std::lock_guard<std::mutex> lock(GetRegistryMutex());
+            for (const SpinlockStatistics* statistics : GetRegistry())
+            {
+                function(*statistics);
+            }
+        }
+
+        static void ResetAll()
+        {
+            std::lock_guard<std::mutex> lock(GetRegistryMutex());
+            for (SpinlockStatistics* statistics : GetRegistry())
+            {
+                statistics->Reset();
+            }
+        }
+
+        const char* m_Name;
+        std::atomic<uint64_t> m_Acquisitions{ 0 };
+        std::atomic<uint64_t> m_ContendedAcquisitions{ 0 }; // Acquisitions that found the lock taken and had to spin or park.
+        std::atomic<uint64_t> m_SpinCycles{ 0 };            // CPU cycles (time stamp counter ticks) spent waiting, including time parked.
+        std::atomic<uint64_t> m_ParkCount{ 0 };             // Times a waiter exhausted its spin budget and went to sleep.
+
+    private:
+        static std::vector<SpinlockStatistics*>& GetRegistry()
+        {
+            static std::vector<SpinlockStatistics*> registry;
+            return registry;
+        }
+
+        static std::mutex& GetRegistryMutex()
+        {
+            static std::mutex registryMutex;
+            return registryMutex;
+        }
+
+        static std::atomic<bool>& GetEnabledFlag()
+        {
+            static std::atomic<bool> isEnabled{ false };
+            return isEnabled;
+        }
+    };
+
     class Spinlock
     {
     public:
+        Spinlock() = default;
+        explicit Spinlock(SpinlockStatistics* statistics) : m_Statistics(statistics) {}
+
+        void SetStatistics(SpinlockStatistics* statistics) { m_Statistics = statistics; }
+
         void Lock()
         {
-            while (!Try_Lock()) {}
+            uint32_t expectedState = Unlocked;
+            if (!m_State.compare_exchange_strong(expectedState, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                LockContended();
+            }
+            else if (m_Statistics && SpinlockStatistics::IsEnabled())
+            {
+                m_Statistics->m_Acquisitions.fetch_add(1, std::memory_order_relaxed);
+            }
         }
 
         bool Try_Lock()
         {
-            return !m_Lock.test_and_set(std::memory_order_acquire);
+            uint32_t expectedState = Unlocked;
+            if (m_State.load(std::memory_order_relaxed) == Unlocked && m_State.compare_exchange_strong(expectedState, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                if (m_Statistics && SpinlockStatistics::IsEnabled())
+                {
+                    m_Statistics->m_Acquisitions.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                return true;
+            }
+
+            return false;
         }
 
         void Unlock()
         {
-            m_Lock.clear(std::memory_order_release);
+            if (m_State.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+            {
+                AddressWait::WakeOne(m_State);
+            }
+        }
+
+        static inline void Pause()
+        {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            __asm__ __volatile__("yield");
+#endif
+        }
+
+        static inline uint64_t ReadCycleCounter()
+        {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+    private:
+        void LockContended()
+        {
+            const bool isRecording = m_Statistics && SpinlockStatistics::IsEnabled();
+            const uint64_t spinStartCycle = isRecording ? ReadCycleCounter() : 0;
+            bool hasParked = false;
+
+            // Spin with exponential backoff, only attempting to take the lock once it looks free.
+            uint32_t backoff = 1;
+            uint32_t spinCount = 0;
+            bool isAcquired = false;
+            while (spinCount < m_SpinBudget)
+            {
+                if (m_State.load(std::memory_order_relaxed) == Unlocked)
+                {
+                    uint32_t expectedState = Unlocked;
+                    if (m_State.compare_exchange_weak(expectedState, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        isAcquired = true;
+                        break;
+                    }
+                }
+
+                for (uint32_t i = 0; i < backoff; i++)
+                {
+                    Pause();
+                }
+
+                spinCount += backoff;
+                backoff = backoff < m_MaxBackoff ? backoff * 2 : m_MaxBackoff;
+            }
+
+            // Out of budget. Mark the lock as having waiters and park until the holder wakes us. We take the lock as LockedWithWaiters, as we can't tell whether others are still parked.
+            if (!isAcquired)
+            {
+                while (m_State.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+                {
+                    hasParked = true;
+                    AddressWait::Wait(m_State, LockedWithWaiters);
+                }
+            }
+
+            if (isRecording)
+            {
+                m_Statistics->m_Acquisitions.fetch_add(1, std::memory_order_relaxed);
+                m_Statistics->m_ContendedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+                m_Statistics->m_SpinCycles.fetch_add(ReadCycleCounter() - spinStartCycle, std::memory_order_relaxed);
+                if (hasParked)
+                {
+                    m_Statistics->m_ParkCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
         }
 
     private:
-        std::atomic_flag m_Lock = ATOMIC_FLAG_INIT;
+        static constexpr uint32_t Unlocked = 0;
+        static constexpr uint32_t Locked = 1;
+        static constexpr uint32_t LockedWithWaiters = 2;
+
+        static constexpr uint32_t m_MaxBackoff = 64;    // Pauses between attempts, at most.
+        static constexpr uint32_t m_SpinBudget = 1024;  // Total pauses before parking. Anywhere from a few to a few dozen microseconds, depending on the CPU's pause latency.
+
+        std::atomic<uint32_t> m_State{ Unlocked };
+        SpinlockStatistics* m_Statistics = nullptr;
     };
 }
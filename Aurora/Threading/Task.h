@@ -0,0 +1,273 @@
+#pragma once
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <atomic>
+#include <utility>
+#include "Threading.h"
+
+/* == Tasks ==
+
+    Task<T> is a lazily started C++20 coroutine that produces a T. It lets us write asynchronous pipelines (read file -> decode -> build mesh -> register in cache) as straight
+    line code, with each stage free to hop onto our worker threads or wait on jobs without ever blocking a thread.
+
+    - co_await task:                          Starts the task on the current thread and resumes us with its result once it finishes.
+    - co_await threading->Schedule():         Moves the rest of the coroutine onto a worker thread.
+    - co_await threading->Await(jobHandle):   Suspends until the given jobs complete. The coroutine is resumed as a dependent job, so no thread sits waiting in the meantime.
+
+    A coroutine is entered through threading->Launch(task) (fire and forget, runs on a worker) or threading->RunAndWait(task), which blocks the caller while helping out with jobs.
+    A suspended coroutine does not occupy a worker - its frame simply sits on the heap until whatever it awaits schedules it again.
+*/
+
+namespace Aurora
+{
+    template<typename T>
+    class Task;
+
+    namespace Detail
+    {
+        struct TaskPromiseBase
+        {
+            // Upon completion, transfer control straight back to whoever awaited us. Symmetric transfer keeps long await chains from growing the stack.
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> coroutine) noexcept
+                {
+                    return coroutine.promise().m_Continuation;
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() { m_Exception = std::current_exception(); }
+
+            void RethrowIfFailed() const
+            {
+                if (m_Exception)
+                {
+                    std::rethrow_exception(m_Exception);
+                }
+            }
+
+            std::coroutine_handle<> m_Continuation = std::noop_coroutine();
+            std::exception_ptr m_Exception;
+        };
+
+        template<typename T>
+        struct TaskPromise : TaskPromiseBase
+        {
+            Task<T> get_return_object() noexcept;
+
+            template<typename Value>
+            void return_value(Value&& value) { m_Value.emplace(std::forward<Value>(value)); }
+
+            T TakeResult()
+            {
+                RethrowIfFailed();
+                return std::move(*m_Value);
+            }
+
+            std::optional<T> m_Value;
+        };
+
+        template<>
+        struct TaskPromise<void> : TaskPromiseBase
+        {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {}
+            void TakeResult() const { RethrowIfFailed(); }
+        };
+    }
+
+    template<typename T = void>
+    class Task
+    {
+    public:
+        using promise_type = Detail::TaskPromise<T>;
+
+        Task() = default;
+        explicit Task(std::coroutine_handle<promise_type> coroutine) : m_Coroutine(coroutine) {}
+
+        Task(Task&& otherTask) noexcept : m_Coroutine(std::exchange(otherTask.m_Coroutine, nullptr)) {}
+
+        Task& operator=(Task&& otherTask) noexcept
+        {
+            if (this != &otherTask)
+            {
+                Destroy();
+                m_Coroutine = std::exchange(otherTask.m_Coroutine, nullptr);
+            }
+
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            Destroy();
+        }
+
+        bool IsValid() const { return static_cast<bool>(m_Coroutine); }
+        bool IsComplete() const { return !m_Coroutine || m_Coroutine.done(); }
+
+        // Awaiting a task starts it on the awaiting thread, with us as its continuation.
+        auto operator co_await() & noexcept { return Awaiter{ m_Coroutine }; }
+        auto operator co_await() && noexcept { return Awaiter{ m_Coroutine }; }
+
+    private:
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return !m_Coroutine || m_Coroutine.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+            {
+                m_Coroutine.promise().m_Continuation = awaitingCoroutine;
+                return m_Coroutine;
+            }
+
+            T await_resume() { return m_Coroutine.promise().TakeResult(); }
+
+            std::coroutine_handle<promise_type> m_Coroutine;
+        };
+
+        void Destroy()
+        {
+            if (m_Coroutine)
+            {
+                m_Coroutine.destroy();
+                m_Coroutine = nullptr;
+            }
+        }
+
+    private:
+        std::coroutine_handle<promise_type> m_Coroutine = nullptr;
+    };
+
+    namespace Detail
+    {
+        template<typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept
+        {
+            return Task<T>{ std::coroutine_handle<TaskPromise<T>>::from_promise(*this) };
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept
+        {
+            return Task<void>{ std::coroutine_handle<TaskPromise<void>>::from_promise(*this) };
+        }
+
+        // Owns itself and destroys its frame upon completion. Used to run a Task without anyone awaiting it.
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() noexcept { return { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+                std::suspend_always initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> m_Coroutine;
+        };
+
+        inline DetachedTask RunDetached(Task<void> task)
+        {
+            co_await task;
+        }
+
+        template<typename T>
+        DetachedTask RunSignalled(Task<T>& task, std::optional<T>& result, std::atomic<bool>& isComplete)
+        {
+            result.emplace(co_await task);
+            isComplete.store(true, std::memory_order_release);
+        }
+
+        inline DetachedTask RunSignalled(Task<void>& task, std::atomic<bool>& isComplete)
+        {
+            co_await task;
+            isComplete.store(true, std::memory_order_release);
+        }
+    }
+
+    // Resumes the awaiting coroutine as a job on our workers.
+    struct ScheduleAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> coroutine) const
+        {
+            m_Threading->Execute([coroutine](JobInformation jobInformation) { coroutine.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+
+        Threading* m_Threading = nullptr;
+    };
+
+    // Resumes the awaiting coroutine as a job that depends on the awaited handle.
+    struct JobHandleAwaiter
+    {
+        bool await_ready() const { return m_Threading->IsComplete(m_JobHandle); }
+
+        void await_suspend(std::coroutine_handle<> coroutine) const
+        {
+            m_Threading->Execute([coroutine](JobInformation jobInformation) { coroutine.resume(); }, { m_JobHandle });
+        }
+
+        void await_resume() const noexcept {}
+
+        Threading* m_Threading = nullptr;
+        JobHandle m_JobHandle;
+    };
+
+    inline ScheduleAwaiter Threading::Schedule()
+    {
+        return ScheduleAwaiter{ this };
+    }
+
+    inline JobHandleAwaiter Threading::Await(const JobHandle& jobHandle)
+    {
+        return JobHandleAwaiter{ this, jobHandle };
+    }
+
+    inline void Threading::Launch(Task<void> task)
+    {
+        const std::coroutine_handle<> coroutine = Detail::RunDetached(std::move(task)).m_Coroutine;
+        Execute([coroutine](JobInformation jobInformation) { coroutine.resume(); });
+    }
+
+    template<typename T>
+    T Threading::RunAndWait(Task<T> task)
+    {
+        std::atomic<bool> isComplete{ false };
+
+        if constexpr (std::is_void<T>::value)
+        {
+            Detail::RunSignalled(task, isComplete).m_Coroutine.resume();
+            while (!isComplete.load(std::memory_order_acquire))
+            {
+                HelpWhileWaiting();
+            }
+        }
+        else
+        {
+            std::optional<T> result;
+            Detail::RunSignalled(task, result, isComplete).m_Coroutine.resume();
+            while (!isComplete.load(std::memory_order_acquire))
+            {
+                HelpWhileWaiting();
+            }
+
+            return std::move(*result);
+        }
+    }
+}
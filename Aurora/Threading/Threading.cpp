@@ -1,84 +1,577 @@
 #include "Aurora.h"
 #include "Threading.h"
+#include "Task.h"
+#include "../Utilities/Memory/AllocationTracker.h"
 #include <thread>
-#define NOMINMAX
-#include <windows.h>
 #include <sstream>
+#include <cmath>
+#include <set>
 #include <assert.h>
-#include <winerror.h>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+    #include <winerror.h>
+#elif defined(__linux__)
+    #include <fstream>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+#endif
 
 namespace Aurora
 {
+    static constexpr uint32_t g_InvalidQueueIndex = ~0u;
+    static thread_local uint32_t g_QueueIndex = g_InvalidQueueIndex; // Index of the calling thread's local deque, if it participates in the job system.
+    static thread_local JobPriority g_ThreadPriority = JobPriority::High; // The worker class of the calling thread. Threads outside of the job system count as high priority.
+    static thread_local uint32_t g_RandomState = 0;                  // Per thread xorshift state used to pick steal victims.
+
+    static uint32_t NextRandom()
+    {
+        if (g_RandomState == 0)
+        {
+            g_RandomState = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+        }
+
+        g_RandomState ^= g_RandomState << 13;
+        g_RandomState ^= g_RandomState >> 17;
+        g_RandomState ^= g_RandomState << 5;
+        return g_RandomState;
+    }
+
+    // Returns one logical processor per physical core (skipping hyperthread siblings), restricted to the processors our process may run on.
+    static std::vector<uint32_t> GetPhysicalCoreProcessors()
+    {
+        std::vector<uint32_t> processors;
+
+#if defined(_WIN32)
+        DWORD bufferSize = 0;
+        GetLogicalProcessorInformation(nullptr, &bufferSize);
+        std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> processorInformation(bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+        if (GetLogicalProcessorInformation(processorInformation.data(), &bufferSize))
+        {
+            for (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION& information : processorInformation)
+            {
+                if (information.Relationship != RelationProcessorCore)
+                {
+                    continue;
+                }
+
+                // Take the lowest logical processor of this core.
+                for (uint32_t processor = 0; processor < sizeof(ULONG_PTR) * 8; processor++)
+                {
+                    if (information.ProcessorMask & (static_cast<ULONG_PTR>(1) << processor))
+                    {
+                        processors.push_back(processor);
+                        break;
+                    }
+                }
+            }
+        }
+#elif defined(__linux__)
+        cpu_set_t allowedProcessors;
+        CPU_ZERO(&allowedProcessors);
+        if (sched_getaffinity(0, sizeof(allowedProcessors), &allowedProcessors) != 0)
+        {
+            return processors;
+        }
+
+        std::set<std::pair<int, int>> seenCores; // (Package, Core) pairs.
+        for (uint32_t processor = 0; processor < CPU_SETSIZE; processor++)
+        {
+            if (!CPU_ISSET(processor, &allowedProcessors))
+            {
+                continue;
+            }
+
+            const std::string topologyPath = "/sys/devices/system/cpu/cpu" + std::to_string(processor) + "/topology/";
+            std::ifstream packageFile(topologyPath + "physical_package_id");
+            std::ifstream coreFile(topologyPath + "core_id");
+
+            int packageID = 0;
+            int coreID = static_cast<int>(processor); // Treat every processor as its own core if the topology isn't exposed (such as in some containers).
+            if (packageFile && coreFile)
+            {
+                packageFile >> packageID;
+                coreFile >> coreID;
+            }
+
+            if (seenCores.insert({ packageID, coreID }).second)
+            {
+                processors.push_back(processor);
+            }
+        }
+#endif
+
+        return processors;
+    }
+
+    void Threading::SetupWorkerThread(std::thread& worker, const std::string& threadName, int32_t processor)
+    {
+#if defined(_WIN32)
+        // We will use the following to name our threads officially, allowing them to show up in Visual Studio Debugger.
+        HANDLE hHandle = (HANDLE)worker.native_handle();
+        std::wstringstream wideStringName;
+        wideStringName << threadName.c_str();
+        SetThreadDescription(hHandle, wideStringName.str().c_str());
+
+        if (processor >= 0)
+        {
+            SetThreadAffinityMask(hHandle, static_cast<DWORD_PTR>(1) << processor);
+        }
+#elif defined(__linux__)
+        // Linux limits thread names to 15 characters.
+        pthread_setname_np(worker.native_handle(), threadName.substr(0, 15).c_str());
+
+        if (processor >= 0)
+        {
+            cpu_set_t processorSet;
+            CPU_ZERO(&processorSet);
+            CPU_SET(processor, &processorSet);
+            pthread_setaffinity_np(worker.native_handle(), sizeof(processorSet), &processorSet);
+        }
+#endif
+    }
+
+    // Lowers the scheduling priority of background workers so they yield to frame critical threads. Called from the worker itself.
+    static void ApplyThreadPriority(JobPriority priority)
+    {
+        if (priority != JobPriority::Background)
+        {
+            return;
+        }
+
+#if defined(_WIN32)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+        setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10); // Under Linux, niceness applies per thread.
+#endif
+    }
+
     Threading::Threading(EngineContext* engineContext) : ISubsystem(engineContext)
     {
 
     }
 
     bool Threading::Initialize()
+    {
+        ThreadingConfiguration configuration;
+        if (Settings* settings = m_EngineContext ? m_EngineContext->GetSubsystem<Settings>() : nullptr)
+        {
+            configuration = settings->GetThreadingConfiguration();
+        }
+
+        return Initialize(configuration);
+    }
+
+    bool Threading::Initialize(const ThreadingConfiguration& configuration)
     {
         // Retrieve the total number of hardware threads in the system.
-        m_ThreadCountTotal = std::thread::hardware_concurrency();
+        m_ThreadCountTotal = std::max(std::thread::hardware_concurrency(), 1u);
 
-        // Calculate the actual number of worker threads we want (-1 for the main thread, or any subsystems we wish to reserve a thread for).
-        m_ThreadCountSupported = m_ThreadCountTotal - 1;
+        // Calculate the actual number of worker threads we want (-1 for the main thread, along with any background workers we reserve threads for).
+        m_BackgroundWorkerCount = configuration.m_BackgroundWorkerCount;
+        m_FrameWorkerCount = configuration.m_FrameWorkerCount != 0 ? configuration.m_FrameWorkerCount : m_ThreadCountTotal - 1 - std::min(m_BackgroundWorkerCount, m_ThreadCountTotal - 1);
+        m_ThreadCountSupported = m_FrameWorkerCount + m_BackgroundWorkerCount;
         m_ThreadNames[std::this_thread::get_id()] = "Main";
 
+        // Build our task pool's free list. Every slot initially points to the next one.
+        m_Tasks = std::make_unique<JobTask[]>(m_TaskPoolCapacity);
+        for (uint32_t i = 0; i < m_TaskPoolCapacity; i++)
+        {
+            m_Tasks[i].m_NextFree.store(i + 1, std::memory_order_relaxed); // The last slot points to m_TaskPoolCapacity, our end marker.
+            m_Tasks[i].m_ContinuationLock.SetStatistics(&m_ContinuationLockStatistics);
+        }
+        m_FreeTaskHead.store(0);
+
+        // Create a local deque for the main thread (index 0) and every worker. High priority deques (main thread and frame workers) come first, followed by background ones.
+        for (uint32_t i = 0; i < m_ThreadCountSupported + 1; i++)
+        {
+            m_LocalQueues.emplace_back(std::make_unique<WorkStealingQueue<Job, m_LocalQueueCapacity>>());
+        }
+        g_QueueIndex = 0;
+        g_ThreadPriority = JobPriority::High;
+        m_JobTracer.Initialize(m_ThreadCountSupported + 1);
+        Instrumentor::GetInstance().SetThreadName(Instrumentor::GetThreadID(), "Main");
+
+        GetPool(JobPriority::High).m_FirstQueueIndex = 0;
+        GetPool(JobPriority::High).m_QueueCount = m_FrameWorkerCount + 1;
+        GetPool(JobPriority::Background).m_FirstQueueIndex = m_FrameWorkerCount + 1;
+        GetPool(JobPriority::Background).m_QueueCount = m_BackgroundWorkerCount;
+
+        // Frame workers get a physical core each, skipping the first which we leave to the main thread. Any workers beyond our physical core count are left to float.
+        const std::vector<uint32_t> physicalCoreProcessors = configuration.m_PinWorkersToCores ? GetPhysicalCoreProcessors() : std::vector<uint32_t>();
+
         // Create all our worker threads and put them to work.
+        m_IsRunning.store(true);
         for (uint32_t threadID = 0; threadID < m_ThreadCountSupported; threadID++)
         {
-            std::thread worker([this, threadID]
+            const bool isFrameWorker = threadID < m_FrameWorkerCount;
+            const JobPriority priority = isFrameWorker ? JobPriority::High : JobPriority::Background;
+            std::thread worker([this, threadID, priority] { WorkerLoop(threadID + 1, priority); });
+
+            m_ThreadNames[worker.get_id()] = isFrameWorker ? "Worker_" + std::to_string(threadID) : "Background_" + std::to_string(threadID - m_FrameWorkerCount);
+            AURORA_INFO(LogLayer::Engine, "Thread Initiated: %s", m_ThreadNames[worker.get_id()].c_str());
+
+            const int32_t processor = (isFrameWorker && threadID + 1 < physicalCoreProcessors.size()) ? static_cast<int32_t>(physicalCoreProcessors[threadID + 1]) : -1;
+            SetupWorkerThread(worker, m_ThreadNames[worker.get_id()], processor);
+            Instrumentor::GetInstance().SetThreadName(Instrumentor::GetThreadID(worker.get_id()), m_ThreadNames[worker.get_id()]);
+
+            m_Workers.emplace_back(std::move(worker));
+        }
+
+        return true;
+    }
+
+    void Threading::Shutdown()
+    {
+        for (WorkerPool& pool : m_Pools)
+        {
+            std::lock_guard<std::mutex> lock(pool.m_WakeMutex);
+            m_IsRunning.store(false);
+        }
+
+        for (WorkerPool& pool : m_Pools)
+        {
+            pool.m_WakeCondition.notify_all();
+        }
+
+        for (std::thread& worker : m_Workers)
+        {
+            if (worker.joinable())
             {
-                while (true)
+                worker.join();
+            }
+        }
+
+        m_Workers.clear();
+    }
+
+    void Threading::Tick(float deltaTime)
+    {
+        m_JobTracer.Flush();
+
+        uint32_t sleepCountTotal = 0;
+        for (const WorkerPool& pool : m_Pools)
+        {
+            sleepCountTotal += pool.m_SleepCount.load(std::memory_order_relaxed);
+        }
+
+        m_SleepCountLastFrame = sleepCountTotal - m_SleepCountTotal;
+        m_SleepCountTotal = sleepCountTotal;
+    }
+
+    void Threading::WorkerLoop(uint32_t queueIndex, JobPriority priority)
+    {
+        g_QueueIndex = queueIndex;
+        g_ThreadPriority = priority;
+        ApplyThreadPriority(priority);
+
+        WorkerPool& pool = GetPool(priority);
+        while (m_IsRunning.load(std::memory_order_relaxed))
+        {
+            if (!TaskLoop())
+            {
+                // No tasks avaliable. Register ourselves as sleeping before re-checking for work, so a submitter either sees us asleep or we see its job.
+                std::unique_lock<std::mutex> lock(pool.m_WakeMutex);
+                pool.m_SleepingThreadCount.fetch_add(1);
+
+                const bool isSleeping = pool.m_PendingJobCount.load() == 0 && m_IsRunning.load();
+                const int64_t sleepStartTime = (isSleeping && m_JobTracer.IsEnabled()) ? JobTracer::GetTimestamp() : 0;
+                if (isSleeping)
                 {
-                    if (!TaskLoop())
-                    {
-                        // No tasks avaliable.
-                        std::unique_lock<std::mutex> lock(m_WakeMutex);
-                        m_WakeCondition.wait(lock); // Unlock and allow execution to proceed once condition is met.
-                    }
+                    pool.m_SleepCount.fetch_add(1, std::memory_order_relaxed);
+                    pool.m_WakeCondition.wait(lock, [this, &pool]() { return pool.m_PendingJobCount.load() > 0 || !m_IsRunning.load(); }); // Unlock and allow execution to proceed once condition is met.
                 }
-            });
 
-            m_ThreadNames[worker.get_id()] = "Worker_" + std::to_string(threadID);
-            AURORA_INFO(LogLayer::Engine, "Thread Initiated: %s", m_ThreadNames[worker.get_id()].c_str());
+                pool.m_SleepingThreadCount.fetch_sub(1);
+                lock.unlock();
+
+                if (sleepStartTime != 0)
+                {
+                    JobTraceEvent sleepEvent;
+                    sleepEvent.m_Label = "Sleep";
+                    sleepEvent.m_Category = "sleep";
+                    sleepEvent.m_ThreadID = JobTracer::GetThreadID();
+                    sleepEvent.m_StartTime = sleepStartTime;
+                    sleepEvent.m_EndTime = JobTracer::GetTimestamp();
+                    m_JobTracer.Record(queueIndex, sleepEvent);
+                }
+            }
+        }
+    }
 
-            // Platform specific setup. We will use the following to name our threads officially, allowing them to show up in Visual Studio Debugger.
-            HANDLE hHandle = (HANDLE)worker.native_handle();
-            std::wstringstream wideStringName;
-            wideStringName << m_ThreadNames[worker.get_id()].c_str();
-            SetThreadDescription(hHandle, wideStringName.str().c_str());
+    bool Threading::FetchJobFromPool(JobPriority priority, Job& job)
+    {
+        WorkerPool& pool = GetPool(priority);
+        if (pool.m_SharedQueue.pop_front(job))
+        {
+            return true;
+        }
 
-            worker.detach(); // Seperates the thread of execution, allowing execution to continue independantly. https://stackoverflow.com/questions/22803600/when-should-i-use-stdthreaddetache5
+        if (pool.m_QueueCount == 0)
+        {
+            return false;
         }
 
-        return true;
+        // Start at a random victim so thieves spread out rather than all hammering the same deque.
+        const uint32_t startIndex = NextRandom() % pool.m_QueueCount;
+        for (uint32_t i = 0; i < pool.m_QueueCount; i++)
+        {
+            const uint32_t victimIndex = pool.m_FirstQueueIndex + (startIndex + i) % pool.m_QueueCount;
+            if (victimIndex != g_QueueIndex && m_LocalQueues[victimIndex]->Steal(job))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Retrieves a job from our own deque first, then from our pool's shared queue and finally attempts to steal from other threads of our pool. Idle background workers also
+    // help out with high priority work, but never the other way around - frame critical threads must not get stuck in long running background jobs.
+    bool Threading::FetchJob(Job& job)
+    {
+        const uint32_t queueIndex = g_QueueIndex;
+        if (queueIndex != g_InvalidQueueIndex && m_LocalQueues[queueIndex]->Pop(job))
+        {
+            return true;
+        }
+
+        if (FetchJobFromPool(g_ThreadPriority, job))
+        {
+            return true;
+        }
+
+        return g_ThreadPriority == JobPriority::Background && FetchJobFromPool(JobPriority::High, job);
     }
 
     // The meat of our library. This function runs across all threads and is used to execute our jobs.
     bool Threading::TaskLoop()
     {
         Job job;
-        if (m_JobQueue.pop_front(job))
+        if (FetchJob(job))
+        {
+            GetPool(m_Tasks[job.m_TaskIndex].m_Priority).m_PendingJobCount.fetch_sub(1);
+            ExecuteJob(job);
+            return true;
+        }
+
+        return false;
+    }
+
+    void Threading::ExecuteJob(const Job& job)
+    {
+        JobTask& task = m_Tasks[job.m_TaskIndex];
+
+        const uint32_t groupJobOffset = job.m_GroupID * task.m_GroupSize;
+        const uint32_t groupJobEnd = std::min(groupJobOffset + task.m_GroupSize, task.m_JobCount);
+
+        JobInformation jobInformation = {};
+        jobInformation.m_GroupID = job.m_GroupID;
+
+        // Submissions made from within a job inherit its label.
+        JobLabelScope labelScope(task.m_Label);
+
+        const bool isTracing = m_JobTracer.IsEnabled();
+        const int64_t startTime = isTracing ? JobTracer::GetTimestamp() : 0;
+
+        for (uint32_t i = groupJobOffset; i < groupJobEnd; ++i)
+        {
+            jobInformation.m_JobIndex = i;
+            jobInformation.m_GroupIndex = i - groupJobOffset;
+            jobInformation.m_IsFirstJobInGroup = (i == groupJobOffset);
+            jobInformation.m_IsLastJobInGroup = (i == groupJobEnd - 1);
+            task.m_Function(jobInformation);
+        }
+
+        // Record before releasing our group, after which the task slot may be reused.
+        if (isTracing)
+        {
+            JobTraceEvent traceEvent;
+            traceEvent.m_Label = task.m_Label;
+            traceEvent.m_Category = task.m_Priority == JobPriority::Background ? "job_background" : "job";
+            traceEvent.m_ThreadID = JobTracer::GetThreadID();
+            traceEvent.m_GroupID = job.m_GroupID;
+            traceEvent.m_GroupCount = task.m_GroupCount;
+            traceEvent.m_EnqueueTime = task.m_EnqueueTime != 0 ? task.m_EnqueueTime : startTime; // Tracing may have been enabled after this task was queued.
+            traceEvent.m_StartTime = startTime;
+            traceEvent.m_EndTime = JobTracer::GetTimestamp();
+            m_JobTracer.Record(g_QueueIndex, traceEvent);
+        }
+
+        // The last group to complete cleans up after the task.
+        if (task.m_GroupsRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
         {
-            AURORA_INFO(LogLayer::Engine, "Handling Thread Job: Thread %u!", std::this_thread::get_id());
+            task.m_Function = nullptr; // Release any captured resources now rather than when the slot is reused.
+            CompleteTask(job.m_TaskIndex);
+        }
+
+        m_Counter.fetch_sub(1);
+    }
 
-            JobInformation jobInformation = {};
-            jobInformation.m_GroupID = job.m_GroupID;
+    void Threading::SubmitJob(const Job& job, JobPriority priority)
+    {
+        WorkerPool& pool = GetPool(priority);
+        pool.m_PendingJobCount.fetch_add(1);
 
-            for (uint32_t i = job.m_GroupJobOffset; i < job.m_GroupJobEnd; ++i)
+        // Threads of the job's worker class push onto their own deque. Anyone else goes through the class's shared queue.
+        const uint32_t queueIndex = g_QueueIndex;
+        if (queueIndex != g_InvalidQueueIndex && g_ThreadPriority == priority)
+        {
+            // Try to push this job until it is pushed successfully. If our deque is full, we execute existing jobs to make space.
+            while (!m_LocalQueues[queueIndex]->Push(job))
+            {
+                WakeWorkers(priority, m_ThreadCountSupported);
+                TaskLoop();
+            }
+        }
+        else
+        {
+            while (!pool.m_SharedQueue.push_back(job))
             {
-                jobInformation.m_JobIndex = i;
-                jobInformation.m_GroupIndex = i - job.m_GroupJobOffset;
-                jobInformation.m_IsFirstJobInGroup = (i == job.m_GroupJobOffset);
-                jobInformation.m_IsLastJobInGroup = (i == job.m_GroupJobEnd - 1);
-                job.m_Job(jobInformation);
+                WakeWorkers(priority, m_ThreadCountSupported);
+                if (!TaskLoop())
+                {
+                    std::this_thread::yield(); // We may not be allowed to run jobs of this class ourselves.
+                }
             }
+        }
+    }
 
-            m_Counter.fetch_sub(1);
-            return true;
+    void Threading::WakeWorkers(JobPriority priority, uint32_t jobCount)
+    {
+        WorkerPool& pool = GetPool(priority);
+
+        // Skip the mutex entirely if nobody is asleep. Otherwise, briefly acquire it so we can't slip our notification in between a worker's final check and its wait.
+        if (pool.m_SleepingThreadCount.load() == 0)
+        {
+            return;
         }
 
-        return false;
+        {
+            std::lock_guard<std::mutex> lock(pool.m_WakeMutex);
+        }
+
+        if (jobCount == 1)
+        {
+            pool.m_WakeCondition.notify_one();
+        }
+        else
+        {
+            pool.m_WakeCondition.notify_all();
+        }
+    }
+
+    void Threading::WakeAllWorkers()
+    {
+        WakeWorkers(JobPriority::High, m_ThreadCountSupported);
+        WakeWorkers(JobPriority::Background, m_ThreadCountSupported);
+    }
+
+    uint32_t Threading::AllocateTask()
+    {
+        while (true)
+        {
+            uint64_t head = m_FreeTaskHead.load(std::memory_order_acquire);
+            const uint32_t taskIndex = static_cast<uint32_t>(head);
+
+            if (taskIndex < m_TaskPoolCapacity)
+            {
+                const uint64_t nextIndex = m_Tasks[taskIndex].m_NextFree.load(std::memory_order_relaxed);
+                const uint64_t newHead = ((head >> 32) + 1) << 32 | nextIndex;
+                if (m_FreeTaskHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return taskIndex;
+                }
+            }
+            else
+            {
+                // Every slot is in flight. Help out until one frees up.
+                WakeAllWorkers();
+                if (!TaskLoop())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    void Threading::ReleaseTask(uint32_t taskIndex)
+    {
+        uint64_t head = m_FreeTaskHead.load(std::memory_order_relaxed);
+        uint64_t newHead;
+
+        do
+        {
+            m_Tasks[taskIndex].m_NextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            newHead = ((head >> 32) + 1) << 32 | taskIndex;
+        } while (!m_FreeTaskHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void Threading::ScheduleTask(uint32_t taskIndex)
+    {
+        const uint32_t groupCount = m_Tasks[taskIndex].m_GroupCount;
+        const JobPriority priority = m_Tasks[taskIndex].m_Priority;
+        m_Tasks[taskIndex].m_EnqueueTime = m_JobTracer.IsEnabled() ? JobTracer::GetTimestamp() : 0;
+        for (uint32_t groupID = 0; groupID < groupCount; ++groupID)
+        {
+            // For each group, generate one job to handle it.
+            SubmitJob({ taskIndex, groupID }, priority);
+        }
+
+        // Wake up any threads that might be sleeping.
+        WakeWorkers(priority, groupCount);
+    }
+
+    void Threading::CompleteTask(uint32_t taskIndex)
+    {
+        JobTask& task = m_Tasks[taskIndex];
+
+        // Detach our continuations and invalidate outstanding handles in one go, so a concurrent AddContinuation() either makes it into the list or sees us as complete.
+        task.m_ContinuationLock.Lock();
+        uint32_t linkID = task.m_ContinuationHead;
+        task.m_ContinuationHead = ~0u;
+        task.m_Generation.fetch_add(1, std::memory_order_release);
+        task.m_ContinuationLock.Unlock();
+
+        ReleaseTask(taskIndex);
+
+        while (linkID != ~0u)
+        {
+            const uint32_t dependentIndex = linkID / g_MaxJobDependencies;
+            JobTask& dependent = m_Tasks[dependentIndex];
+
+            // Read the next link before releasing the dependent, as it may run, complete and be recycled immediately after.
+            const uint32_t nextLinkID = dependent.m_DependencyLinks[linkID % g_MaxJobDependencies];
+            if (dependent.m_DependenciesRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                ScheduleTask(dependentIndex);
+            }
+
+            linkID = nextLinkID;
+        }
+    }
+
+    bool Threading::AddContinuation(const JobHandle& dependency, uint32_t taskIndex, uint32_t linkSlot)
+    {
+        JobTask& dependencyTask = m_Tasks[dependency.m_TaskIndex];
+        bool isAdded = false;
+
+        dependencyTask.m_ContinuationLock.Lock();
+        if (dependencyTask.m_Generation.load(std::memory_order_relaxed) == dependency.m_Generation)
+        {
+            const uint32_t linkID = taskIndex * g_MaxJobDependencies + linkSlot;
+            m_Tasks[taskIndex].m_DependencyLinks[linkSlot] = dependencyTask.m_ContinuationHead;
+            dependencyTask.m_ContinuationHead = linkID;
+            isAdded = true;
+        }
+        dependencyTask.m_ContinuationLock.Unlock();
+
+        return isAdded; // False if the dependency has already completed.
     }
 
     uint32_t Threading::CalculateDispatchJobCount(uint32_t jobCount, uint32_t groupSize)
@@ -87,11 +580,16 @@ namespace Aurora
         return (jobCount + groupSize - 1) / groupSize;
     }
 
-    void Threading::Dispatch(uint32_t jobCount, uint32_t groupSize, const std::function<void(JobInformation)>& jobInformation)
+    JobHandle Threading::Dispatch(uint32_t jobCount, uint32_t groupSize, JobFunction jobInformation, std::initializer_list<JobHandle> dependencies, JobPriority priority)
+    {
+        return Dispatch(jobCount, groupSize, std::move(jobInformation), dependencies.begin(), static_cast<uint32_t>(dependencies.size()), priority);
+    }
+
+    JobHandle Threading::Dispatch(uint32_t jobCount, uint32_t groupSize, JobFunction jobInformation, const JobHandle* dependencies, uint32_t dependencyCount, JobPriority priority)
     {
         if (jobCount == 0 || groupSize == 0)
         {
-            return;
+            return JobHandle();
         }
 
         const uint32_t groupCount = CalculateDispatchJobCount(jobCount, groupSize); // Tells us how many worker threads (or groups) will be activated to handle the queue.
@@ -99,72 +597,153 @@ namespace Aurora
         // Update context state.
         m_Counter.fetch_add(groupCount);
 
-        Job job;
-        job.m_Job = jobInformation;
-
-        for (uint32_t groupID = 0; groupID < groupCount; ++groupID)
+        // The function is stored once and shared by every group.
+        const uint32_t taskIndex = AllocateTask();
+        JobTask& task = m_Tasks[taskIndex];
+        task.m_Function = std::move(jobInformation);
+        task.m_JobCount = jobCount;
+        task.m_GroupSize = groupSize;
+        task.m_GroupCount = groupCount;
+        task.m_Label = JobLabelScope::GetCurrentLabel();
+        task.m_Priority = (priority == JobPriority::Background && m_BackgroundWorkerCount == 0) ? JobPriority::High : priority; // Without background workers, nobody would pick these up.
+        task.m_GroupsRemaining.store(groupCount, std::memory_order_relaxed);
+
+        // Read our generation before the task can possibly complete and move it on.
+        const JobHandle jobHandle = { taskIndex, task.m_Generation.load(std::memory_order_relaxed) };
+
+        // We hold one extra dependency of our own while registering, so the task can't be scheduled by a dependency that completes midway through.
+        task.m_DependenciesRemaining.store(1, std::memory_order_relaxed);
+
+        uint32_t linkSlot = 0;
+        for (uint32_t i = 0; i < dependencyCount; i++)
         {
-            // For each group, generate one job to handle it.
-            job.m_GroupID = groupID;
-            job.m_GroupJobOffset = groupID * groupSize;
-            job.m_GroupJobEnd = std::min(job.m_GroupJobOffset + groupSize, jobCount); // The last task belonging to this job.
+            const JobHandle& dependency = dependencies[i];
+            if (!dependency.IsValid())
+            {
+                continue;
+            }
 
-            // Try to push this job until it is pushed successfully.
-            while (!m_JobQueue.push_back(job))
+            if (linkSlot == g_MaxJobDependencies)
             {
-                m_WakeCondition.notify_all();
-                TaskLoop();
+                AURORA_WARNING(LogLayer::Engine, "Job submitted with more than %u dependencies. Waiting on the remainder instead.", g_MaxJobDependencies);
+                Wait(dependency);
+                continue;
+            }
+
+            task.m_DependenciesRemaining.fetch_add(1, std::memory_order_relaxed);
+            if (AddContinuation(dependency, taskIndex, linkSlot))
+            {
+                linkSlot++;
+            }
+            else
+            {
+                task.m_DependenciesRemaining.fetch_sub(1, std::memory_order_relaxed);
             }
         }
 
-        // Wake up any threads that might be sleeping.
-        m_WakeCondition.notify_all();
+        if (task.m_DependenciesRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ScheduleTask(taskIndex);
+        }
+
+        return jobHandle;
     }
 
-    void Threading::Execute(const std::function<void(JobInformation)>& jobInformation)
+    JobHandle Threading::Execute(JobFunction jobInformation, std::initializer_list<JobHandle> dependencies, JobPriority priority)
     {
-        m_Counter.fetch_add(1);
+        return Dispatch(1, 1, std::move(jobInformation), dependencies, priority);
+    }
 
-        Job job;
-        job.m_Job = jobInformation;
-        job.m_GroupID = 0;
-        job.m_GroupJobOffset = 0;
-        job.m_GroupJobEnd = 1;
+    JobHandle Threading::Execute(JobFunction jobInformation, const JobHandle* dependencies, uint32_t dependencyCount, JobPriority priority)
+    {
+        return Dispatch(1, 1, std::move(jobInformation), dependencies, dependencyCount, priority);
+    }
+
+    bool Threading::IsBusy()
+    {
+        // Whenever the context label is greater than 0, it means there are tasks to be completed.
+        return m_Counter.load() > 0;
+    }
 
-        // Try to push a new job. If we're unable to do so, we continue to wake threads up to execute existing tasks to make space for the new job.
-        while (!m_JobQueue.push_back(job))
+    bool Threading::IsComplete(const JobHandle& jobHandle) const
+    {
+        if (!jobHandle.IsValid())
         {
-            m_WakeCondition.notify_all();
-            TaskLoop();
+            return true;
         }
 
-        // Once pushed, we wake up a thread to execute the pushed thread.
-        m_WakeCondition.notify_one();
+        return m_Tasks[jobHandle.m_TaskIndex].m_Generation.load(std::memory_order_acquire) != jobHandle.m_Generation;
     }
 
-    bool Threading::IsBusy()
+    bool Threading::TaskLoopLocal()
     {
-        // Whenever the context label is greater than 0, it means there are tasks to be completed.
-        return m_Counter.load() > 0;
+        Job job;
+        if (g_QueueIndex != g_InvalidQueueIndex && m_LocalQueues[g_QueueIndex]->Pop(job))
+        {
+            GetPool(m_Tasks[job.m_TaskIndex].m_Priority).m_PendingJobCount.fetch_sub(1);
+            ExecuteJob(job);
+            return true;
+        }
+
+        return false;
+    }
+
+    void Threading::HelpWhileWaiting()
+    {
+        // Waiting will also put the current thread to good use by working on a job if it can. The main thread only takes on foreign jobs if allowed to, as it can affect your
+        // current program. It will however always execute jobs it submitted itself, since it would otherwise sit idle waiting on them anyway.
+        const bool canHelp = g_QueueIndex != 0 || m_UseMainThreadForTasks || m_FrameWorkerCount == 0;
+        const bool hasHelped = canHelp ? TaskLoop() : TaskLoopLocal();
+        if (!hasHelped)
+        {
+            std::this_thread::yield();
+        }
     }
 
     void Threading::Wait()
     {
         // Wake any threads that might be sleeping to execute all tasks.
-        m_WakeCondition.notify_all();
+        WakeAllWorkers();
 
-        // Waiting will also put the current thread to good use by working on a job if it can. Disable this to not make our main thread work.
-        if (m_UseMainThreadForTasks)
+        while (IsBusy())
         {
-            TaskLoop();
+            HelpWhileWaiting();
         }
     }
 
+    void Threading::Wait(const JobHandle& jobHandle)
+    {
+        WakeAllWorkers();
+
+        while (!IsComplete(jobHandle))
+        {
+            HelpWhileWaiting();
+        }
+    }
+
+    uint32_t Threading::CalculateGrainSize(uint32_t jobCount, double nanosecondsPerJob) const
+    {
+        // Groups cheaper than this are dominated by scheduling overhead. Groups more expensive than this risk leaving threads idle at the end of a loop.
+        constexpr double minimumGroupNanoseconds = 10000.0;
+        constexpr double maximumGroupNanoseconds = 250000.0;
+        constexpr uint32_t groupsPerThread = 4; // Oversubscribe a little so stealing can even out any imbalance.
+
+        nanosecondsPerJob = std::max(nanosecondsPerJob, 1.0);
+        const uint32_t participantCount = m_FrameWorkerCount + 1;
+
+        const double minimumGrain = std::ceil(minimumGroupNanoseconds / nanosecondsPerJob);
+        const double maximumGrain = std::ceil(maximumGroupNanoseconds / nanosecondsPerJob);
+        const double balancedGrain = std::ceil(static_cast<double>(jobCount) / (participantCount * groupsPerThread));
+
+        const double grainSize = std::min(std::max(balancedGrain, minimumGrain), maximumGrain);
+        return static_cast<uint32_t>(std::min(std::max(grainSize, 1.0), static_cast<double>(jobCount)));
+    }
+
     uint32_t Threading::GetThreadCountAvaliable()
     {
         if (IsBusy())
         {
-            return m_ThreadCountSupported - m_Counter.load();
+            return m_ThreadCountSupported - std::min(m_Counter.load(), m_ThreadCountSupported);
         }
 
         return m_ThreadCountSupported;
@@ -207,28 +786,215 @@ namespace Aurora
         }
     };
 
-    void Threading::SingularTaskUnitTest()
+    void Threading::DispatchAllocationUnitTest()
+    {
+        const uint32_t dispatchCount = 1000;
+        std::atomic<uint32_t> executedCount{ 0 };
+        uint64_t allocationCount = 0;
+
+        {
+            MiniStopwatch T = MiniStopwatch("Dispatch Allocation Test");
+            AllocationScope allocationScope;
+
+            for (uint32_t i = 0; i < dispatchCount; i++)
+            {
+                Dispatch(64, 8, [&executedCount](JobInformation arguments)
+                {
+                    executedCount.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+
+            Wait();
+            allocationCount = allocationScope.GetAllocationCount();
+        }
+
+        if (!AllocationTracker::IsTracking())
+        {
+            AURORA_INFO(LogLayer::Engine, "Dispatch Allocation Test: %u jobs executed across %u dispatches. Allocations are only counted in builds defining AURORA_TRACK_ALLOCATIONS.", executedCount.load(), dispatchCount);
+            return;
+        }
+
+        AURORA_INFO(LogLayer::Engine, "Dispatch Allocation Test: %u jobs executed, %u heap allocations across %u dispatches.", executedCount.load(), static_cast<uint32_t>(allocationCount), dispatchCount);
+    }
+
+    void Threading::ParallelAlgorithmsUnitTest()
+    {
+        const uint32_t dataCount = 1000000;
+        std::vector<uint32_t> values(dataCount);
+        std::vector<uint64_t> prefixSums(dataCount);
+        uint64_t sum = 0;
+
+        {
+            MiniStopwatch T = MiniStopwatch("Parallel For Test");
+            ParallelFor(dataCount, [&values](uint32_t index) { values[index] = index % 7; });
+        }
+
+        {
+            MiniStopwatch T = MiniStopwatch("Parallel Reduce Test");
+            sum = ParallelReduce<uint64_t>(dataCount, 0, [&values](uint32_t index) { return static_cast<uint64_t>(values[index]); }, [](uint64_t a, uint64_t b) { return a + b; });
+        }
+
+        {
+            MiniStopwatch T = MiniStopwatch("Parallel Scan Test");
+            ParallelScan<uint64_t>(dataCount, 0, [&values](uint32_t index) { return static_cast<uint64_t>(values[index]); }, prefixSums.data(), [](uint64_t a, uint64_t b) { return a + b; });
+        }
+
+        const bool isCorrect = prefixSums.back() == sum;
+        AURORA_INFO(LogLayer::Engine, "Parallel Algorithms Test: Sum %llu, Final Prefix %llu (%s).", sum, prefixSums.back(), isCorrect ? "Passed" : "Failed");
+    }
+
+    // A mock "read -> decode -> register" pipeline. Each stage hops onto the workers or awaits a dispatch without blocking any thread.
+    static Task<uint64_t> DecodeAsync(Threading* threading, uint32_t byteCount)
+    {
+        co_await threading->Schedule();
+
+        std::vector<uint32_t> decodedData(byteCount);
+        const JobHandle decodeHandle = threading->Dispatch(byteCount, 1024, [&decodedData](JobInformation arguments) { decodedData[arguments.m_JobIndex] = arguments.m_JobIndex % 255; });
+        co_await threading->Await(decodeHandle);
+
+        uint64_t checksum = 0;
+        for (uint32_t value : decodedData)
+        {
+            checksum += value;
+        }
+
+        co_return checksum;
+    }
+
+    static Task<uint64_t> LoadAsync(Threading* threading, uint32_t fileCount)
+    {
+        uint64_t checksum = 0;
+        for (uint32_t i = 0; i < fileCount; i++)
+        {
+            Spin(1); // Pretend to read a file.
+            checksum += co_await DecodeAsync(threading, 1 << 16);
+        }
+
+        co_return checksum;
+    }
+
+    void Threading::CoroutineUnitTest()
     {
-        MiniStopwatch T = MiniStopwatch("Execute Test");
-        Execute([](JobInformation jobArguments) { Spin(100); });
+        MiniStopwatch T = MiniStopwatch("Coroutine Test");
+        const uint64_t checksum = RunAndWait(LoadAsync(this, 16));
 
-        Wait();
+        AURORA_INFO(LogLayer::Engine, "Coroutine Test: Checksum %llu.", checksum);
     }
 
-    void Threading::LoopingTaskUnitTest()
+    // Pushes a fixed number of items through the queue with an equal number of producer and consumer threads. Returns the elapsed time in milliseconds.
+    template<typename Queue>
+    static double MeasureQueueContention(uint32_t threadPairCount, uint32_t itemCount)
     {
-        uint32_t dataCount = 1000;
+        std::unique_ptr<Queue> queue = std::make_unique<Queue>();
+        std::atomic<uint32_t> consumedCount{ 0 };
+        std::atomic<bool> isStarted{ false };
+        std::vector<std::thread> threads;
+
+        const uint32_t itemsPerProducer = itemCount / threadPairCount;
+        const uint32_t totalItemCount = itemsPerProducer * threadPairCount;
 
+        for (uint32_t i = 0; i < threadPairCount; i++)
         {
-            MiniStopwatch T = MiniStopwatch("Dispatch Test");
+            threads.emplace_back([&queue, &isStarted, itemsPerProducer]()
+            {
+                while (!isStarted.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+                for (uint32_t item = 0; item < itemsPerProducer; item++)
+                {
+                    while (!queue->push_back(item)) { std::this_thread::yield(); }
+                }
+            });
 
-            const uint32_t groupSize = 100; // Split each job into 1000 tasks.
-            Dispatch(dataCount, groupSize, [&dataCount](JobInformation arguments)
+            threads.emplace_back([&queue, &isStarted, &consumedCount, totalItemCount]()
             {
-                Spin(10);
+                while (!isStarted.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+                uint32_t item = 0;
+                while (consumedCount.load(std::memory_order_relaxed) < totalItemCount)
+                {
+                    if (queue->pop_front(item))
+                    {
+                        consumedCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
             });
+        }
 
-            Wait();
+        const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+        isStarted.store(true, std::memory_order_release);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
         }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    void Threading::QueueContentionUnitTest()
+    {
+        const uint32_t itemCount = 1 << 20;
+
+        for (uint32_t threadPairCount = 1; threadPairCount <= 64; threadPairCount *= 2)
+        {
+            const double ringBufferMilliseconds = MeasureQueueContention<RingBuffer<uint32_t, 1024>>(threadPairCount, itemCount);
+            const double mpmcQueueMilliseconds = MeasureQueueContention<MPMCQueue<uint32_t, 1024>>(threadPairCount, itemCount);
+
+            AURORA_INFO(LogLayer::Engine, "Queue Contention Test (%u Producers/%u Consumers): RingBuffer %.3fms, MPMCQueue %.3fms.", threadPairCount, threadPairCount, ringBufferMilliseconds, mpmcQueueMilliseconds);
+        }
+    }
+
+    void Threading::SpinlockContentionUnitTest()
+    {
+        const uint32_t acquisitionsPerThread = 1 << 16;
+        const bool wasRecording = SpinlockStatistics::IsEnabled();
+        SpinlockStatistics::SetEnabled(true);
+
+        for (uint32_t threadCount = 1; threadCount <= m_ThreadCountTotal * 2; threadCount *= 2)
+        {
+            SpinlockStatistics statistics("Spinlock Contention Test");
+            Spinlock spinlock(&statistics);
+            uint64_t sharedCounter = 0;
+            std::atomic<bool> isStarted{ false };
+            std::vector<std::thread> threads;
+
+            for (uint32_t i = 0; i < threadCount; i++)
+            {
+                threads.emplace_back([&spinlock, &sharedCounter, &isStarted, acquisitionsPerThread]()
+                {
+                    while (!isStarted.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+                    for (uint32_t j = 0; j < acquisitionsPerThread; j++)
+                    {
+                        spinlock.Lock();
+                        sharedCounter++;
+                        spinlock.Unlock();
+                    }
+                });
+            }
+
+            const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+            isStarted.store(true, std::memory_order_release);
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            const double elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+            const uint64_t acquisitions = statistics.m_Acquisitions.load();
+            const uint64_t contendedAcquisitions = statistics.m_ContendedAcquisitions.load();
+
+            AURORA_INFO(LogLayer::Engine, "Spinlock Contention Test (%u Threads): %.3fms, %.1f%% Contended, %llu Parks, %.0f Spin Cycles per Contended Acquisition (%s).", threadCount, elapsedMilliseconds,
+                        acquisitions ? 100.0 * contendedAcquisitions / acquisitions : 0.0, static_cast<unsigned long long>(statistics.m_ParkCount.load()),
+                        contendedAcquisitions ? static_cast<double>(statistics.m_SpinCycles.load()) / contendedAcquisitions : 0.0,
+                        sharedCounter == static_cast<uint64_t>(threadCount) * acquisitionsPerThread ? "Passed" : "Failed");
+        }
+
+        SpinlockStatistics::SetEnabled(wasRecording);
     }
 }
\ No newline at end of file
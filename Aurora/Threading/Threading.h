@@ -1,11 +1,23 @@
 #pragma once
 #include "ISubsystem.h"
+#include "SettingsUtilities.h"
 #include <functional>
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <unordered_map>
+#include <thread>
+#include <string>
+#include <vector>
+#include <memory>
+#include <initializer_list>
+#include <chrono>
 #include "RingBuffer.h"
+#include "MPMCQueue.h"
+#include "Spinlock.h"
+#include "WorkStealingQueue.h"
+#include "JobFunction.h"
+#include "JobTracer.h"
 
 /* == Threading ==
 
@@ -14,7 +26,28 @@
 
     We currently supported singular (function) and loop based parallization.
 
-    When notify_all() is called our threads are woken up and will proceed to look for tasks serially, picking up and executing jobs found. If no jobs are found, they return to a perpertual waiting state.
+    Every thread that participates in the job system (the main thread and each worker) owns a work stealing deque. Jobs submitted from such a thread are pushed onto its own
+    deque, and are popped back off in LIFO order. A thread that runs out of local work steals from the top of a randomly chosen victim's deque. Threads outside of the job system
+    submit into a small lock-free shared queue instead. As such, there is no single queue lock that every worker contends on.
+
+    The function of a task is stored once in a shared JobTask slot, and each queued Job merely references it by index along with its group ID, keeping queued items small
+    enough to be moved around atomically. Functions are held in a fixed size JobFunction rather than a std::function, so submitting work never allocates. Workers with nothing to do go to sleep on their pool's m_WakeCondition and are woken up whenever new jobs are pushed.
+
+    Dispatch and Execute return a JobHandle, which can be waited on individually or passed as a dependency to later submissions ("run B after A"). Dependent tasks are not
+    queued at all until their dependencies complete, at which point the thread finishing the last dependency schedules them. No thread ever blocks to enforce ordering.
+
+    ParallelFor, ParallelReduce and ParallelScan sit on top of Dispatch and pick their own group sizes. They execute the first few items on the calling thread while timing
+    them, and use the observed per-item cost to size groups so each one is long enough to amortize scheduling, yet numerous enough to keep every thread busy.
+
+    Workers come in two classes, each with its own deques, shared queue and sleep state. Frame workers (along with the main thread) run high priority, frame critical work and
+    are pinned to their own physical cores. Background workers run at a lowered OS priority and pick up long running jobs such as file I/O and asset imports, which are submitted
+    with JobPriority::Background. Idle background workers help out with high priority work, but frame workers never pick up background jobs, so a slow import can never stall
+    a frame. Worker counts per class are configured through the ThreadingConfiguration given to the Engine's constructor, which the editor takes from the command line
+    (see Demo.cpp).
+
+    The job timeline (queue, start and end times of every job group along with worker sleeps) can be recorded with SetJobTracingEnabled. See JobTracer.h.
+
+    Coroutine support (Task<T>) lives in Task.h, which also defines the coroutine related members below. Include it wherever those are used.
 */
 
 namespace Aurora
@@ -28,12 +61,60 @@ namespace Aurora
         bool m_IsLastJobInGroup;  // Is the current job the last one in the group?
     };
 
+    // The class of workers a submission runs on.
+    enum class JobPriority : uint32_t
+    {
+        High,       // Frame critical work. Runs on the main thread and frame workers.
+        Background, // Long running work such as file I/O and asset imports. Runs on background workers, or on frame workers if there are none.
+        Count
+    };
+
+    template<typename T>
+    class Task;
+    struct ScheduleAwaiter;
+    struct JobHandleAwaiter;
+
+    // Captures of up to 64 bytes are stored inline. Larger captures are rejected at compile time.
+    using JobFunction = InlineFunction<void(JobInformation), 64>;
+
+    // Refers to a single Dispatch/Execute call. A handle completes once every job of its call has finished. Cheap to copy - it is merely a slot index and the generation of
+    // that slot at submission time. Once the task completes, the slot's generation moves on and the handle remains complete forever, even if the slot is reused.
+    struct JobHandle
+    {
+        bool IsValid() const { return m_TaskIndex != ~0u; }
+
+        uint32_t m_TaskIndex = ~0u;
+        uint32_t m_Generation = 0;
+    };
+
+    static constexpr uint32_t g_MaxJobDependencies = 8; // Per submission. Any excess dependencies are waited on by the submitting thread instead.
+
+    // Shared state of a single Dispatch/Execute call. Referenced by all of its jobs instead of being copied into each of them.
+    struct JobTask
+    {
+        JobFunction m_Function;
+        uint32_t m_JobCount = 0;
+        uint32_t m_GroupSize = 0;
+        uint32_t m_GroupCount = 0;
+        JobPriority m_Priority = JobPriority::High;
+        const char* m_Label = nullptr; // See AURORA_JOB_LABEL.
+        int64_t m_EnqueueTime = 0;     // When the task was queued, if tracing.
+        std::atomic<uint32_t> m_GroupsRemaining{ 0 };       // The last group to finish completes this task and releases it back into the pool.
+        std::atomic<uint32_t> m_DependenciesRemaining{ 0 }; // The task is only queued once this reaches zero.
+        std::atomic<uint32_t> m_Generation{ 0 };            // Incremented upon completion, invalidating all handles to this submission.
+        std::atomic<uint32_t> m_NextFree{ 0 };              // Intrusive link for the free list.
+
+        // Tasks waiting on us. Each entry is a link ID (dependent task index * g_MaxJobDependencies + link slot), chained through the dependents' own m_DependencyLinks.
+        Spinlock m_ContinuationLock;
+        uint32_t m_ContinuationHead = ~0u;
+        uint32_t m_DependencyLinks[g_MaxJobDependencies] = {}; // Embedded list nodes used when this task is registered as a continuation of others.
+    };
+
+    // A queued unit of work - one group of a task. Kept at 8 bytes so our deques can store it atomically.
     struct Job
     {
-        std::function<void(JobInformation)> m_Job;
+        uint32_t m_TaskIndex = 0;
         uint32_t m_GroupID = 0;
-        uint32_t m_GroupJobOffset = 0;
-        uint32_t m_GroupJobEnd = 0;
     };
 
     class Threading : public ISubsystem
@@ -41,7 +122,10 @@ namespace Aurora
     public:
         Threading(EngineContext* engineContext);
         
-        bool Initialize() override; // Creates our internal resources such as worker threads.
+        bool Initialize() override; // Creates our internal resources such as worker threads, configured through Settings.
+        bool Initialize(const ThreadingConfiguration& configuration); // As above, with an explicit configuration. Allows standalone instances, such as those of JobBenchmark.
+        void Tick(float deltaTime) override; // Flushes the job trace of the previous frame.
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_Profiling, false }; }
 
         /* == Dispatch ==
         * 
@@ -50,44 +134,349 @@ namespace Aurora
             - Job Count: The amount of jobs to generate for this thread.
             - Group Size: How many jobs to execute per thread. Jobs inside a group execute serially. Any idle thread will execute this job.
             - Job Information: Receives a JobInformation struct as a parameter.
+            - Priority: The class of workers to run on. Use JobPriority::Background for anything that may block or run for longer than a frame.
         */
 
-        void Dispatch(uint32_t jobCount, uint32_t groupSize, const std::function<void(JobInformation)>& jobInformation);
-        void Execute(const std::function<void(JobInformation)>& jobInformation); // Adds a task to execute asynchronously. Any idle thread will execute this job.
+        JobHandle Dispatch(uint32_t jobCount, uint32_t groupSize, JobFunction jobInformation, std::initializer_list<JobHandle> dependencies = {}, JobPriority priority = JobPriority::High);
+        JobHandle Execute(JobFunction jobInformation, std::initializer_list<JobHandle> dependencies = {}, JobPriority priority = JobPriority::High); // Adds a task to execute asynchronously. Any idle thread will execute this job.
+
+        // As above, for dependencies gathered at runtime.
+        JobHandle Dispatch(uint32_t jobCount, uint32_t groupSize, JobFunction jobInformation, const JobHandle* dependencies, uint32_t dependencyCount, JobPriority priority = JobPriority::High);
+        JobHandle Execute(JobFunction jobInformation, const JobHandle* dependencies, uint32_t dependencyCount, JobPriority priority = JobPriority::High);
         
         bool IsBusy(); // Allows the main thread to check if any worker threads are busy executing jobs.
-        void Wait();   // Wait until all threads become idle.
+        bool IsComplete(const JobHandle& jobHandle) const;
+        void Wait();                            // Wait until all threads become idle. Helps execute pending jobs in the meantime.
+        void Wait(const JobHandle& jobHandle);  // Wait until the given submission completes. Helps execute pending jobs in the meantime.
+
+        /* == Parallel Algorithms ==
+
+            Blocking loops over [0, count). The calling thread participates. Ranges too cheap to be worth distributing simply run on the calling thread.
+
+            - ParallelFor: Calls body(index) for each index.
+            - ParallelForRange: Calls body(begin, end) for contiguous sub-ranges. Prefer this when the body benefits from batching.
+            - ParallelReduce: Combines map(index) across all indices with reduce(a, b), which must be associative. Partial results are combined in index order.
+            - ParallelScan: Writes the inclusive prefix of map(index) under operation(a, b) into output. The operation must be associative.
+        */
 
-        void SingularTaskUnitTest();
-        void LoopingTaskUnitTest();
+        template<typename Body>
+        void ParallelFor(uint32_t count, Body&& body);
+        template<typename RangeBody>
+        void ParallelForRange(uint32_t count, RangeBody&& body);
+        template<typename T, typename MapFunction, typename ReduceFunction>
+        T ParallelReduce(uint32_t count, const T& identity, MapFunction&& map, ReduceFunction&& reduce);
+        template<typename T, typename MapFunction, typename Operation>
+        void ParallelScan(uint32_t count, const T& identity, MapFunction&& map, T* output, Operation&& operation);
+
+        // Coroutines - See Task.h.
+        ScheduleAwaiter Schedule();                         // co_await to continue the current coroutine on a worker thread.
+        JobHandleAwaiter Await(const JobHandle& jobHandle); // co_await to continue once the given submission completes, without blocking any thread.
+        void Launch(Task<void> task);                       // Starts a coroutine on the workers without waiting for it.
+        template<typename T>
+        T RunAndWait(Task<T> task);                         // Runs a coroutine to completion, helping execute pending jobs while waiting.
+
+        void DispatchAllocationUnitTest();
+        void ParallelAlgorithmsUnitTest();
+        void CoroutineUnitTest();
+        void QueueContentionUnitTest();
+        void SpinlockContentionUnitTest();
 
         uint32_t GetThreadCount() const { return m_ThreadCountTotal; }
         uint32_t GetThreadCountSupported() const { return m_ThreadCountSupported; }
+        uint32_t GetFrameWorkerCount() const { return m_FrameWorkerCount; }
+        uint32_t GetBackgroundWorkerCount() const { return m_BackgroundWorkerCount; }
         uint32_t GetThreadCountAvaliable();
 
         uint32_t GetQueuedTasksCount() const { return m_Counter.load(); }
 
+        // Tracing - See JobTracer.h.
+        void SetJobTracingEnabled(bool isEnabled) { m_JobTracer.SetEnabled(isEnabled); }
+        bool IsJobTracingEnabled() const { return m_JobTracer.IsEnabled(); }
+        uint32_t GetTracedEventCountLastFrame() const { return m_JobTracer.GetFlushedEventCount(); }
+        uint32_t GetDroppedTraceEventCountLastFrame() const { return m_JobTracer.GetDroppedEventCount(); }
+        uint32_t GetWorkerSleepCountLastFrame() const { return m_SleepCountLastFrame; } // How often workers went to sleep on their wake condition during the last frame.
+
+        static void SetupWorkerThread(std::thread& worker, const std::string& threadName, int32_t processor = -1); // Names a thread and optionally pins it to a processor. Called from the spawning thread.
+
         bool IsMainThreadUtilitizedForTasks() const { return m_UseMainThreadForTasks; }
         void UseMainThreadForTasks(bool value) { m_UseMainThreadForTasks = value; } // Not recommended as it can affect your current program.
    
+        void Shutdown() override; // Wakes and joins all worker threads.
+
     private:
         bool TaskLoop();
+        void WorkerLoop(uint32_t queueIndex, JobPriority priority);
+        void ExecuteJob(const Job& job);
+        void SubmitJob(const Job& job, JobPriority priority);
+        bool FetchJob(Job& job);
+        bool FetchJobFromPool(JobPriority priority, Job& job);
+        void WakeWorkers(JobPriority priority, uint32_t jobCount);
+        void WakeAllWorkers();
+        bool TaskLoopLocal(); // Only executes jobs from the calling thread's own deque.
+        void HelpWhileWaiting();
+
+        // Parallel Algorithms
+        template<typename RangeBody>
+        uint32_t ExecuteSample(uint32_t count, RangeBody& body, double& nanosecondsPerJob);
+        uint32_t CalculateGrainSize(uint32_t jobCount, double nanosecondsPerJob) const;
         uint32_t CalculateDispatchJobCount(uint32_t jobCount, uint32_t groupSize);
 
+        // Task Pool
+        uint32_t AllocateTask();
+        void ReleaseTask(uint32_t taskIndex);
+        void ScheduleTask(uint32_t taskIndex);
+        void CompleteTask(uint32_t taskIndex);
+        bool AddContinuation(const JobHandle& dependency, uint32_t taskIndex, uint32_t linkSlot);
+
     public:
         std::unordered_map<std::thread::id, std::string> m_ThreadNames;
 
+    private:
+        // Queues and sleep state of a single class of workers.
+        struct WorkerPool
+        {
+            std::condition_variable m_WakeCondition; // Used with m_WakeMutex. Worker threads simply sleep when there are no jobs and can be waken up with this condition.
+            std::mutex m_WakeMutex;                  // As above.
+            std::atomic<uint32_t> m_SleepingThreadCount{ 0 }; // Lets submitters skip the wake mutex entirely when every worker is already awake.
+            std::atomic<uint32_t> m_PendingJobCount{ 0 };     // Jobs of this class currently sitting in any queue. Sleeping workers wait for this to become non-zero.
+            std::atomic<uint32_t> m_SleepCount{ 0 };          // Times any worker of this class went to sleep.
+            MPMCQueue<Job, 256> m_SharedQueue;                // Submissions from threads outside of this class (which have no local deque of it) end up here.
+            uint32_t m_FirstQueueIndex = 0;                   // The local deques of this class' threads, which its thieves steal from.
+            uint32_t m_QueueCount = 0;
+        };
+
+        WorkerPool& GetPool(JobPriority priority) { return m_Pools[static_cast<uint32_t>(priority)]; }
+
     private:
         bool m_UseMainThreadForTasks = false;
 
         uint32_t m_ThreadCountTotal = 0;         // Total thread count for our system.
-        uint32_t m_ThreadCountSupported = 0;     // -1 for the main thread. We can also reserve certain threads for certain systems.
-        
-        std::condition_variable m_WakeCondition; // Used with g_WakeMutex. Worker threads simply sleep when there are no jobs and can be waken up with this condition.
-        std::mutex m_WakeMutex;                  // As above.
+        uint32_t m_ThreadCountSupported = 0;     // Worker threads of all classes. Excludes the main thread.
+        uint32_t m_FrameWorkerCount = 0;
+        uint32_t m_BackgroundWorkerCount = 0;
+
+        WorkerPool m_Pools[static_cast<uint32_t>(JobPriority::Count)];
+        std::atomic<bool> m_IsRunning{ false };
 
         std::atomic<uint32_t> m_Counter{ 0 };    // Defines a state of execution. Can be waited on. This tells us how many threads must finish their tasks for the threading library to become idle.
-        RingBuffer<Job, 256> m_JobQueue;         // A thread safe queue to put pending jobs onto. This has a capacity of 256 jobs. A worker thread can grab a job from the end of the queue, and new tasks are appended to the start.
-        EngineContext* m_EngineContext;
+
+        static constexpr uint32_t m_LocalQueueCapacity = 1024;
+        static constexpr uint32_t m_TaskPoolCapacity = 1024;
+
+        std::vector<std::unique_ptr<WorkStealingQueue<Job, m_LocalQueueCapacity>>> m_LocalQueues; // One per participating thread. Index 0 belongs to the main thread, followed by frame then background workers.
+        std::vector<std::thread> m_Workers;
+
+        std::unique_ptr<JobTask[]> m_Tasks;      // Fixed pool of task slots, recycled through a lock-free free list.
+        std::atomic<uint64_t> m_FreeTaskHead{ 0 }; // Lower 32 bits hold the slot index, upper 32 bits an ABA tag.
+
+        SpinlockStatistics m_ContinuationLockStatistics{ "Job Continuations" }; // Shared by the continuation locks of all task slots.
+        JobTracer m_JobTracer;
+        uint32_t m_SleepCountTotal = 0;     // Across all pools, as of our last tick.
+        uint32_t m_SleepCountLastFrame = 0;
     };
+
+    // Runs progressively larger batches from the start of the range on the calling thread until enough time has passed to trust the measurement. Returns how many jobs ran.
+    template<typename RangeBody>
+    uint32_t Threading::ExecuteSample(uint32_t count, RangeBody& body, double& nanosecondsPerJob)
+    {
+        constexpr double sampleNanoseconds = 2000.0;
+
+        const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+        uint32_t sampledCount = 0;
+        uint32_t batchSize = 1;
+        double elapsedNanoseconds = 0.0;
+
+        while (sampledCount < count)
+        {
+            const uint32_t batchEnd = std::min(sampledCount + batchSize, count);
+            body(sampledCount, batchEnd);
+            sampledCount = batchEnd;
+
+            elapsedNanoseconds = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - startTime).count();
+            if (elapsedNanoseconds >= sampleNanoseconds)
+            {
+                break;
+            }
+
+            batchSize *= 2;
+        }
+
+        nanosecondsPerJob = elapsedNanoseconds / sampledCount;
+        return sampledCount;
+    }
+
+    template<typename Body>
+    void Threading::ParallelFor(uint32_t count, Body&& body)
+    {
+        ParallelForRange(count, [&body](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                body(i);
+            }
+        });
+    }
+
+    template<typename RangeBody>
+    void Threading::ParallelForRange(uint32_t count, RangeBody&& body)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        double nanosecondsPerJob = 0.0;
+        const uint32_t offset = ExecuteSample(count, body, nanosecondsPerJob);
+        const uint32_t remainingCount = count - offset;
+        if (remainingCount == 0)
+        {
+            return;
+        }
+
+        const uint32_t grainSize = CalculateGrainSize(remainingCount, nanosecondsPerJob);
+        if (grainSize >= remainingCount)
+        {
+            body(offset, count); // Not worth distributing.
+            return;
+        }
+
+        // One job per group of items, so the body is invoked once per range rather than once per item.
+        const uint32_t groupCount = CalculateDispatchJobCount(remainingCount, grainSize);
+        const JobHandle jobHandle = Dispatch(groupCount, 1, [&body, offset, grainSize, count](JobInformation jobInformation)
+        {
+            const uint32_t begin = offset + jobInformation.m_JobIndex * grainSize;
+            body(begin, std::min(begin + grainSize, count));
+        });
+
+        Wait(jobHandle);
+    }
+
+    template<typename T, typename MapFunction, typename ReduceFunction>
+    T Threading::ParallelReduce(uint32_t count, const T& identity, MapFunction&& map, ReduceFunction&& reduce)
+    {
+        T result = identity;
+        auto reduceRange = [&map, &reduce](uint32_t begin, uint32_t end, T& accumulator)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                accumulator = reduce(accumulator, map(i));
+            }
+        };
+
+        auto sampleBody = [&reduceRange, &result](uint32_t begin, uint32_t end) { reduceRange(begin, end, result); };
+        double nanosecondsPerJob = 0.0;
+        const uint32_t offset = count > 0 ? ExecuteSample(count, sampleBody, nanosecondsPerJob) : 0;
+        const uint32_t remainingCount = count - offset;
+        if (remainingCount == 0)
+        {
+            return result;
+        }
+
+        const uint32_t grainSize = CalculateGrainSize(remainingCount, nanosecondsPerJob);
+        if (grainSize >= remainingCount)
+        {
+            reduceRange(offset, count, result);
+            return result;
+        }
+
+        // Each group reduces into its own partial, which are then combined in order on the calling thread.
+        const uint32_t groupCount = CalculateDispatchJobCount(remainingCount, grainSize);
+        std::vector<T> partialResults(groupCount, identity);
+        T* partialResultsData = partialResults.data();
+
+        const JobHandle jobHandle = Dispatch(groupCount, 1, [&reduceRange, partialResultsData, offset, grainSize, count](JobInformation jobInformation)
+        {
+            const uint32_t begin = offset + jobInformation.m_JobIndex * grainSize;
+            reduceRange(begin, std::min(begin + grainSize, count), partialResultsData[jobInformation.m_JobIndex]);
+        });
+
+        Wait(jobHandle);
+
+        for (const T& partialResult : partialResults)
+        {
+            result = reduce(result, partialResult);
+        }
+
+        return result;
+    }
+
+    template<typename T, typename MapFunction, typename Operation>
+    void Threading::ParallelScan(uint32_t count, const T& identity, MapFunction&& map, T* output, Operation&& operation)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Scan the start of the range serially. This doubles as our cost sample.
+        T carry = identity;
+        auto scanBody = [&map, &operation, output, &carry](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                carry = operation(carry, map(i));
+                output[i] = carry;
+            }
+        };
+
+        double nanosecondsPerJob = 0.0;
+        const uint32_t offset = ExecuteSample(count, scanBody, nanosecondsPerJob);
+        const uint32_t remainingCount = count - offset;
+        if (remainingCount == 0)
+        {
+            return;
+        }
+
+        // The parallel path touches every item twice, hence it must be worth twice as much.
+        const uint32_t grainSize = CalculateGrainSize(remainingCount, nanosecondsPerJob);
+        if (grainSize >= remainingCount / 2)
+        {
+            scanBody(offset, count);
+            return;
+        }
+
+        const uint32_t groupCount = CalculateDispatchJobCount(remainingCount, grainSize);
+        std::vector<T> groupCarries(groupCount, identity);
+        T* groupCarriesData = groupCarries.data();
+
+        // Pass 1: Reduce each group independently.
+        const JobHandle reduceHandle = Dispatch(groupCount, 1, [&map, &operation, groupCarriesData, offset, grainSize, count](JobInformation jobInformation)
+        {
+            const uint32_t begin = offset + jobInformation.m_JobIndex * grainSize;
+            const uint32_t end = std::min(begin + grainSize, count);
+
+            T groupTotal = groupCarriesData[jobInformation.m_JobIndex];
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                groupTotal = operation(groupTotal, map(i));
+            }
+            groupCarriesData[jobInformation.m_JobIndex] = groupTotal;
+        });
+
+        Wait(reduceHandle);
+
+        // Turn group totals into the carry entering each group.
+        for (T& groupCarry : groupCarries)
+        {
+            const T groupTotal = groupCarry;
+            groupCarry = carry;
+            carry = operation(carry, groupTotal);
+        }
+
+        // Pass 2: Scan each group, starting from its carry.
+        const JobHandle scanHandle = Dispatch(groupCount, 1, [&map, &operation, output, groupCarriesData, offset, grainSize, count](JobInformation jobInformation)
+        {
+            const uint32_t begin = offset + jobInformation.m_JobIndex * grainSize;
+            const uint32_t end = std::min(begin + grainSize, count);
+
+            T runningValue = groupCarriesData[jobInformation.m_JobIndex];
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                runningValue = operation(runningValue, map(i));
+                output[i] = runningValue;
+            }
+        });
+
+        Wait(scanHandle);
+    }
 }
\ No newline at end of file
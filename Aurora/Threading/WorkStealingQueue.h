@@ -0,0 +1,106 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+    A bounded Chase-Lev work stealing deque. Each worker owns one of these. The owning thread pushes and pops from the bottom (LIFO, which keeps recently produced and thus
+    cache-warm work local), while any other thread may steal from the top (FIFO). Only steals and the owner's final item race with one another, so the common push/pop path is
+    free of any read-modify-write operations.
+
+    The memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli - 2013), minus the buffer growth. When the deque
+    is full, Push() fails and the caller is expected to execute work itself to make space, exactly as with our RingBuffer.
+
+    As thieves may read a slot while the owner overwrites it (after which the thief's CAS is guarenteed to fail), items are stored in atomics and must be trivially copyable.
+    Keep them small enough to remain lock-free (8 bytes or less on x64).
+*/
+
+namespace Aurora
+{
+    template<typename T, size_t capacity>
+    class WorkStealingQueue
+    {
+        static_assert((capacity & (capacity - 1)) == 0, "WorkStealingQueue capacity must be a power of two.");
+        static_assert(std::is_trivially_copyable<T>::value, "WorkStealingQueue items must be trivially copyable.");
+
+    public:
+        // Pushes an item onto the bottom of the deque. Owner thread only. Returns false if the deque is full.
+        inline bool Push(const T& item)
+        {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_Top.load(std::memory_order_acquire);
+
+            if (bottom - top >= static_cast<int64_t>(capacity))
+            {
+                return false;
+            }
+
+            m_Data[bottom & m_Mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        // Pops the most recently pushed item. Owner thread only. Returns false if the deque is empty or a thief took the last item.
+        inline bool Pop(T& item)
+        {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Empty. Restore the bottom index.
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            item = m_Data[bottom & m_Mask].load(std::memory_order_relaxed);
+            if (top != bottom)
+            {
+                return true; // More than one item remains, hence no thief can be contending for this one.
+            }
+
+            // Last item - race any thieves for it.
+            const bool isSuccessful = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return isSuccessful;
+        }
+
+        // Steals the oldest item. Safe to call from any thread. Returns false if the deque is empty or we lost the race for the item.
+        inline bool Steal(T& item)
+        {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return false;
+            }
+
+            item = m_Data[top & m_Mask].load(std::memory_order_relaxed);
+            return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        // Approximate number of items in the deque. Only exact when called by the owner with no thieves active.
+        inline size_t size() const
+        {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+        }
+
+    private:
+        static constexpr int64_t m_Mask = static_cast<int64_t>(capacity) - 1;
+
+        // Top and bottom are written by different threads. Keep them on seperate cache lines to avoid false sharing.
+        alignas(64) std::atomic<int64_t> m_Top{ 0 };
+        alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+        alignas(64) std::atomic<T> m_Data[capacity];
+    };
+}
@@ -18,6 +18,7 @@ namespace Aurora
         ~Timer() = default;
 
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_Time, false }; }
 
         float GetDeltaTimeInSeconds() const { return static_cast<float>(m_DeltaTimeInMilliseconds / 1000.0); } // The time interval in seconds from the last frame to the current one.
         double GetDeltaTimeInMilliseconds() const { return m_DeltaTimeInMilliseconds; }
@@ -0,0 +1,53 @@
+#include "Aurora.h"
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace Aurora
+{
+#if defined(AURORA_TRACK_ALLOCATIONS)
+    static thread_local uint64_t g_ThreadAllocationCount = 0;
+    static thread_local uint64_t g_ThreadAllocatedBytes = 0;
+
+    uint64_t AllocationTracker::GetThreadAllocationCount()
+    {
+        return g_ThreadAllocationCount;
+    }
+
+    uint64_t AllocationTracker::GetThreadAllocatedBytes()
+    {
+        return g_ThreadAllocatedBytes;
+    }
+#else
+    uint64_t AllocationTracker::GetThreadAllocationCount()
+    {
+        return 0;
+    }
+
+    uint64_t AllocationTracker::GetThreadAllocatedBytes()
+    {
+        return 0;
+    }
+#endif
+}
+
+#if defined(AURORA_TRACK_ALLOCATIONS)
+// Global replacements. Array forms and sized deletes forward to these by default.
+void* operator new(std::size_t size)
+{
+    Aurora::g_ThreadAllocationCount++;
+    Aurora::g_ThreadAllocatedBytes += size;
+
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+#endif
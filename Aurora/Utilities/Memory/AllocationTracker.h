@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+
+/*
+    Counts heap allocations made through the global operator new. Counts are kept per thread so tracking stays free of contention, and so a benchmark can measure exactly
+    what its own thread allocated around a call (such as Threading::Dispatch) without interference from worker threads.
+
+    Counting means replacing operator new for the whole process, dependencies included, hence it is only compiled into builds defining AURORA_TRACK_ALLOCATIONS. Elsewhere,
+    counts stay at 0 and IsTracking() tells callers not to trust them.
+*/
+
+namespace Aurora
+{
+    class AllocationTracker
+    {
+    public:
+#if defined(AURORA_TRACK_ALLOCATIONS)
+        static constexpr bool IsTracking() { return true; }
+#else
+        static constexpr bool IsTracking() { return false; }
+#endif
+
+        static uint64_t GetThreadAllocationCount(); // Number of allocations made by the calling thread since it started.
+        static uint64_t GetThreadAllocatedBytes();  // Total bytes requested by the calling thread since it started.
+    };
+
+    // Convenience scope for measuring the allocations of a block of code on the calling thread.
+    class AllocationScope
+    {
+    public:
+        AllocationScope() : m_StartCount(AllocationTracker::GetThreadAllocationCount()), m_StartBytes(AllocationTracker::GetThreadAllocatedBytes()) {}
+
+        uint64_t GetAllocationCount() const { return AllocationTracker::GetThreadAllocationCount() - m_StartCount; }
+        uint64_t GetAllocatedBytes() const { return AllocationTracker::GetThreadAllocatedBytes() - m_StartBytes; }
+
+    private:
+        uint64_t m_StartCount = 0;
+        uint64_t m_StartBytes = 0;
+    };
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+#include "../../Threading/Spinlock.h"
+
+/* == Block Pools ==
+
+    Objects created and destroyed in bulk (entities, index nodes) each cost a trip to the heap when allocated individually, and end up scattered across memory. A BlockPool
+    hands out fixed size blocks carved from large chunks instead, with freed blocks kept in an intrusive free list for reuse. Chunks are only returned to the system when the
+    pool itself is destroyed.
+
+    A BlockPoolSet keeps a pool per block size, and PoolAllocator<T> adapts it to the standard allocator interface. Any standard container or std::allocate_shared can thus
+    draw from the set - each allocation is routed to the pool of its exact size. Large requests (such as the bucket arrays of hash maps) and over-aligned ones fall back to
+    the global heap, as pooling them would merely park memory in chunks.
+
+    Allocators share ownership of their set. Objects which outlive the owner of the set (such as an entity whose shared_ptr is held by the editor after its world is gone)
+    can thus still return their memory safely. Allocation is guarded by a Spinlock, as the last reference to a pooled object may be dropped on any thread.
+*/
+
+namespace Aurora
+{
+    class BlockPool
+    {
+    public:
+        BlockPool(size_t blockSize, uint32_t blocksPerChunk = 256)
+        {
+            // Every block must be able to hold our free list link, and keep the blocks after it aligned.
+            m_BlockSize = (std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+            m_BlocksPerChunk = blocksPerChunk;
+        }
+
+        BlockPool(const BlockPool& otherPool) = delete;
+        BlockPool& operator=(const BlockPool& otherPool) = delete;
+
+        void* Allocate()
+        {
+            if (!m_FreeBlocks)
+            {
+                AllocateChunk();
+            }
+
+            FreeBlock* block = m_FreeBlocks;
+            m_FreeBlocks = block->m_NextBlock;
+            m_AllocatedBlockCount++;
+
+            return block;
+        }
+
+        void Deallocate(void* memory)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(memory);
+            block->m_NextBlock = m_FreeBlocks;
+            m_FreeBlocks = block;
+            m_AllocatedBlockCount--;
+        }
+
+        size_t GetBlockSize() const { return m_BlockSize; }
+        uint32_t GetAllocatedBlockCount() const { return m_AllocatedBlockCount; }
+        uint32_t GetChunkCount() const { return static_cast<uint32_t>(m_Chunks.size()); }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* m_NextBlock;
+        };
+
+        void AllocateChunk()
+        {
+            std::unique_ptr<std::byte[]>& chunk = m_Chunks.emplace_back(std::make_unique<std::byte[]>(m_BlockSize * m_BlocksPerChunk));
+
+            // Thread every block of the chunk onto our free list, in address order.
+            for (uint32_t i = m_BlocksPerChunk; i > 0; i--)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk.get() + m_BlockSize * (i - 1));
+                block->m_NextBlock = m_FreeBlocks;
+                m_FreeBlocks = block;
+            }
+        }
+
+    private:
+        size_t m_BlockSize = 0;
+        uint32_t m_BlocksPerChunk = 0;
+        uint32_t m_AllocatedBlockCount = 0;
+
+        FreeBlock* m_FreeBlocks = nullptr;
+        std::vector<std::unique_ptr<std::byte[]>> m_Chunks;
+    };
+
+    class BlockPoolSet
+    {
+    public:
+        void* Allocate(size_t size, size_t alignment)
+        {
+            if (!IsPooled(size, alignment))
+            {
+                return alignment > alignof(std::max_align_t) ? ::operator new(size, std::align_val_t(alignment)) : ::operator new(size);
+            }
+
+            m_Lock.Lock();
+            void* memory = GetPool(size).Allocate();
+            m_Lock.Unlock();
+
+            return memory;
+        }
+
+        void Deallocate(void* memory, size_t size, size_t alignment)
+        {
+            if (!IsPooled(size, alignment))
+            {
+                if (alignment > alignof(std::max_align_t))
+                {
+                    ::operator delete(memory, std::align_val_t(alignment));
+                }
+                else
+                {
+                    ::operator delete(memory);
+                }
+                return;
+            }
+
+            m_Lock.Lock();
+            GetPool(size).Deallocate(memory);
+            m_Lock.Unlock();
+        }
+
+        // Blocks currently handed out across every pool.
+        uint32_t GetAllocatedBlockCount()
+        {
+            m_Lock.Lock();
+            uint32_t allocatedBlockCount = 0;
+            for (const std::unique_ptr<BlockPool>& blockPool : m_Pools)
+            {
+                allocatedBlockCount += blockPool->GetAllocatedBlockCount();
+            }
+            m_Lock.Unlock();
+
+            return allocatedBlockCount;
+        }
+
+    private:
+        static constexpr size_t m_MaximumBlockSize = 1024;
+
+        static bool IsPooled(size_t size, size_t alignment) { return size <= m_MaximumBlockSize && alignment <= alignof(std::max_align_t); }
+
+        // We only ever hold a handful of sizes, hence the linear search.
+        BlockPool& GetPool(size_t size)
+        {
+            for (size_t i = 0; i < m_PoolSizes.size(); i++)
+            {
+                if (m_PoolSizes[i] == size)
+                {
+                    return *m_Pools[i];
+                }
+            }
+
+            m_PoolSizes.push_back(size);
+            return *m_Pools.emplace_back(std::make_unique<BlockPool>(size));
+        }
+
+    private:
+        Spinlock m_Lock;
+        std::vector<size_t> m_PoolSizes; // Requested size of each pool, parallel to m_Pools.
+        std::vector<std::unique_ptr<BlockPool>> m_Pools;
+    };
+
+    template<typename T>
+    class PoolAllocator
+    {
+    public:
+        using value_type = T;
+
+        PoolAllocator(const std::shared_ptr<BlockPoolSet>& blockPoolSet) : m_BlockPoolSet(blockPoolSet) { }
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U>& otherAllocator) : m_BlockPoolSet(otherAllocator.GetBlockPoolSet()) { }
+
+        T* allocate(size_t count) { return static_cast<T*>(m_BlockPoolSet->Allocate(sizeof(T) * count, alignof(T))); }
+        void deallocate(T* memory, size_t count) { m_BlockPoolSet->Deallocate(memory, sizeof(T) * count, alignof(T)); }
+
+        const std::shared_ptr<BlockPoolSet>& GetBlockPoolSet() const { return m_BlockPoolSet; }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U>& otherAllocator) const { return m_BlockPoolSet == otherAllocator.GetBlockPoolSet(); }
+        template<typename U>
+        bool operator!=(const PoolAllocator<U>& otherAllocator) const { return m_BlockPoolSet != otherAllocator.GetBlockPoolSet(); }
+
+    private:
+        std::shared_ptr<BlockPoolSet> m_BlockPoolSet;
+    };
+}
@@ -29,6 +29,7 @@ namespace Aurora
         virtual bool Initialize() override;
         virtual void Shutdown() override;
         void Tick(float deltaTime) override;
+        SubsystemTickAccess GetTickAccess() const override { return { SubsystemResource_None, SubsystemResource_Window, true }; } // GLFW must be polled from the main thread.
         void SetEventCallback(const EventCallbackFunction& inputCallback);
         void SetWindowCallbacks();
 
@@ -110,14 +110,14 @@ namespace EditorConfigurations
 		return false;
 	}
 
-	Editor::Editor()
+	Editor::Editor(const Aurora::ThreadingConfiguration& threadingConfiguration)
 	{
 		Aurora::Instrumentor::GetInstance().BeginSession("Startup");
 
 		Aurora::AURORA_PROFILE_FUNCTION();
 
 		// Create Engine
-		m_Engine = std::make_unique<Aurora::Engine>();
+		m_Engine = std::make_unique<Aurora::Engine>(threadingConfiguration);
 
 		// Acquire useful engine subsystems.
 		m_EngineContext = m_Engine->GetEngineContext();;
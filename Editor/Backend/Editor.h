@@ -21,6 +21,7 @@ public:
 	void SetEditorInstance(Editor* editor) { m_Editor = editor; }
 
 	void OnEvent(Aurora::InputEvent& inputEvent) override;
+	Aurora::SubsystemTickAccess GetTickAccess() const override { return { Aurora::SubsystemResource_None, Aurora::SubsystemResource_None, false }; } // We only handle events.
 	bool OnKeyPressed(Aurora::KeyPressedEvent& inputEvent);
 
 private:
@@ -30,7 +31,7 @@ private:
 class Editor
 {
 public:
-	Editor();
+	Editor(const Aurora::ThreadingConfiguration& threadingConfiguration = Aurora::ThreadingConfiguration());
 	~Editor();
 
 	void Tick();
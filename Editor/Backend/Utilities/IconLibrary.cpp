@@ -113,7 +113,7 @@ const Icon& IconLibrary::LoadIcon_(const std::string& filePath, IconType iconTyp
         m_EngineContext->GetSubsystem<Aurora::Threading>()->Execute([this, filePath, texture](Aurora::JobInformation jobArguments)
             {
                 texture->LoadFromFile(filePath);
-            });
+            }, {}, Aurora::JobPriority::Background);
 
         m_Icons.emplace_back(iconType, texture);
 
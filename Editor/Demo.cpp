@@ -1,17 +1,103 @@
 #include "Backend/Editor.h"
 #include "Engine.h"
+#include "../Scene/WorldBenchmark.h"
+#include <cstdlib>
+#include <cstring>
 #include <objbase.h> // Temporary to save us pain and suffering from CoInitialize spamming.
 
-int main(int argc, int argv[])
+// Threading options, accepted by the editor and the world benchmark alike, each given as -option=value. See ThreadingConfiguration for their defaults.
+//
+//   -frame_workers, -background_workers, -io_workers  Threads of each class. 0 frame workers uses every hardware thread left over.
+//   -pin_workers                                      1 pins each frame worker to its own physical core, 0 leaves them to the OS.
+static bool ParseThreadingOption(const std::string& option, const char* value, Aurora::ThreadingConfiguration* threadingConfiguration)
+{
+    if (option == "-frame_workers")           { threadingConfiguration->m_FrameWorkerCount = std::strtoul(value, nullptr, 10); }
+    else if (option == "-background_workers") { threadingConfiguration->m_BackgroundWorkerCount = std::strtoul(value, nullptr, 10); }
+    else if (option == "-io_workers")         { threadingConfiguration->m_IOWorkerCount = std::strtoul(value, nullptr, 10); }
+    else if (option == "-pin_workers")        { threadingConfiguration->m_PinWorkersToCores = std::strtoul(value, nullptr, 10) != 0; }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// Runs every World Benchmark measurement on the engine alone, without the editor or its frame loop, and writes the results out for trend tracking. This isn't headless:
+// every engine subsystem still initializes, the window and D3D11 device included, as lights and cameras depend on the renderer. Machines without a display or GPU can't
+// run it. Large scenes are generated with the options below, each given as -option=value after -world_benchmark. See SceneGenerator.h for their defaults.
+//
+//   -depth, -children                              Levels per generated hierarchy, and children per entity above the deepest.
+//   -renderables, -lights, -rigidbodies, -scripts  Chance of any generated entity being given each component, from 0 to 1.
+//   -move, -churn                                  Share of roots moved and of entities churned per tick, from 0 to 1.
+//   -seed, -output                                 Output defaults to ../ProfilerLogs/WorldBenchmark.json.
+static int RunWorldBenchmark(int argc, char* argv[])
+{
+    Aurora::ThreadingConfiguration threadingConfiguration;
+    Aurora::SceneGeneratorSettings sceneSettings;
+    std::string outputPath = "../ProfilerLogs/WorldBenchmark.json";
+
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        const size_t separator = argument.find('=');
+        const std::string option = argument.substr(0, separator);
+        const char* value = separator != std::string::npos ? argv[i] + separator + 1 : "";
+
+        if (option == "-depth")            { sceneSettings.m_HierarchyDepth = std::strtoul(value, nullptr, 10); }
+        else if (option == "-children")    { sceneSettings.m_ChildrenPerEntity = std::strtoul(value, nullptr, 10); }
+        else if (option == "-renderables") { sceneSettings.m_RenderableRatio = std::strtof(value, nullptr); }
+        else if (option == "-lights")      { sceneSettings.m_LightRatio = std::strtof(value, nullptr); }
+        else if (option == "-rigidbodies") { sceneSettings.m_RigidBodyRatio = std::strtof(value, nullptr); }
+        else if (option == "-scripts")     { sceneSettings.m_ScriptRatio = std::strtof(value, nullptr); }
+        else if (option == "-move")        { sceneSettings.m_MoveRatio = std::strtof(value, nullptr); }
+        else if (option == "-churn")       { sceneSettings.m_ChurnRatio = std::strtof(value, nullptr); }
+        else if (option == "-seed")        { sceneSettings.m_Seed = std::strtoul(value, nullptr, 10); }
+        else if (option == "-output")      { outputPath = value; }
+        else if (!ParseThreadingOption(option, value, &threadingConfiguration))
+        {
+            AURORA_WARNING(Aurora::LogLayer::Engine, "Unknown world benchmark option \"%s\" ignored.", argument.c_str());
+        }
+    }
+
+    Aurora::Engine engine(threadingConfiguration);
+    Aurora::WorldBenchmark worldBenchmark(engine.GetEngineContext());
+    worldBenchmark.Run();
+    worldBenchmark.RunLargeScenes({ 10000, 100000, 1000000 }, sceneSettings);
+
+    return worldBenchmark.WriteJson(outputPath) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[])
 {
     HRESULT hr = CoInitialize(NULL);
     srand(time(0)); // Seed generator.
 
-    Editor editor;
-    
+    if (argc > 1 && std::strcmp(argv[1], "-world_benchmark") == 0)
+    {
+        const int exitCode = RunWorldBenchmark(argc, argv);
+        CoUninitialize();
+        return exitCode;
+    }
+
+    Aurora::ThreadingConfiguration threadingConfiguration;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        const size_t separator = argument.find('=');
+        const char* value = separator != std::string::npos ? argv[i] + separator + 1 : "";
+
+        if (!ParseThreadingOption(argument.substr(0, separator), value, &threadingConfiguration))
+        {
+            AURORA_WARNING(Aurora::LogLayer::Engine, "Unknown option \"%s\" ignored.", argument.c_str());
+        }
+    }
+
+    Editor editor(threadingConfiguration);
+
     editor.Tick();
 
     AURORA_INFO(Aurora::LogLayer::Engine, "Beginning Engine Shutdown...");
 
     CoUninitialize();
-}
\ No newline at end of file
+}
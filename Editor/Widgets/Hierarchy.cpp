@@ -24,6 +24,12 @@ namespace HierarchyGlobals
     bool m_Expand_To_Selection = false;
     bool m_Expanded_To_Selection = false;
     ImRect m_Selected_Entity_Rect;
+
+    // Root entities, gathered anew only when the world's change journal reports entities coming, going or being reparented. Kept as handles rather than references,
+    // so that we never keep destroyed roots alive whilst hidden or between refreshes. Handles of destroyed entities no longer resolve, and are skipped.
+    static std::vector<Aurora::EntityHandle> g_Root_Entities;
+    static uint64_t g_Journal_Frame_Index = 0;
+    static bool g_Are_Roots_Stale = true;
 }
 
 Hierarchy::Hierarchy(Editor* editorContext, Aurora::EngineContext* engineContext) : Widget(editorContext, engineContext)
@@ -91,13 +97,37 @@ void Hierarchy::ShowEntityTree()
 
     /// Dropping on the scene node should unparent the entity.
     
-    std::vector<std::shared_ptr<Aurora::Entity>> rootEntities = HierarchyGlobals::g_WorldSubsystem->EntityGetRoots();
+    const Aurora::WorldChangeJournal& changeJournal = HierarchyGlobals::g_WorldSubsystem->GetChangeJournal();
+    if (changeJournal.GetFrameIndex() != HierarchyGlobals::g_Journal_Frame_Index)
+    {
+        // Having missed a frame, we can't tell what it changed.
+        const bool hasMissedFrame = changeJournal.GetFrameIndex() != HierarchyGlobals::g_Journal_Frame_Index + 1;
+        HierarchyGlobals::g_Are_Roots_Stale |= hasMissedFrame ||
+                                               changeJournal.HasChanges(Aurora::WorldChangeType::EntityCreated) ||
+                                               changeJournal.HasChanges(Aurora::WorldChangeType::EntityDestroyed) ||
+                                               changeJournal.HasChanges(Aurora::WorldChangeType::HierarchyChanged);
+        HierarchyGlobals::g_Journal_Frame_Index = changeJournal.GetFrameIndex();
+    }
+
+    if (HierarchyGlobals::g_Are_Roots_Stale)
+    {
+        HierarchyGlobals::g_Root_Entities.clear();
+        for (const std::shared_ptr<Aurora::Entity>& rootEntity : HierarchyGlobals::g_WorldSubsystem->EntityGetRoots())
+        {
+            HierarchyGlobals::g_Root_Entities.push_back(rootEntity->GetEntityHandle());
+        }
+
+        HierarchyGlobals::g_Are_Roots_Stale = false;
+    }
     
-    for (const std::shared_ptr<Aurora::Entity>& entity : rootEntities)
+    for (Aurora::EntityHandle rootHandle : HierarchyGlobals::g_Root_Entities)
     {
-        ImGui::PushID(entity->GetObjectID());
-        TreeAddEntity(entity.get());
-        ImGui::PopID();
+        if (Aurora::Entity* entity = HierarchyGlobals::g_WorldSubsystem->GetEntityByHandle(rootHandle))
+        {
+            ImGui::PushID(entity->GetObjectID());
+            TreeAddEntity(entity);
+            ImGui::PopID();
+        }
     }
     
     // If we have been expanding to show an entity and no more expansions are taking place, we're done with it. Thus, we stop expanding and bring it into view.
@@ -283,8 +313,7 @@ void Hierarchy::PopupContextMenu()
 
         if (ImGui::MenuItem("Delete"))
         {
-            selectedEntity->MarkForDestruction();
-            HierarchyGlobals::g_WorldSubsystem->SetSceneDirty();
+            HierarchyGlobals::g_WorldSubsystem->EntityRemove(selectedEntity);
             EditorExtensions::ContextHelper::GetInstance().m_SelectedEntity.reset();
         }
 
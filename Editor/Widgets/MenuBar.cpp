@@ -1,6 +1,7 @@
 #include "MenuBar.h"
 #include "../Scene/World.h"
 #include "../Threading/Threading.h"
+#include "../Threading/IOService.h"
 #include "../Backend/Utilities/Extensions.h"
 #include <optional>
 #include "../Utilities/Version.h"
@@ -187,10 +188,11 @@ void MenuBar::SaveScene()
 	{
 		AURORA_INFO(Aurora::LogLayer::Serialization, "%s", filePath.value().c_str());
 
+		AURORA_JOB_LABEL("Save Scene");
 		m_EngineContext->GetSubsystem<Aurora::Threading>()->Execute([this, filePath](Aurora::JobInformation jobInformation)
 		{
 			m_EngineContext->GetSubsystem<Aurora::World>()->SerializeScene(filePath.value());
-		});
+		}, {}, Aurora::JobPriority::Background);
 	}
 }
 
@@ -202,10 +204,9 @@ void MenuBar::LoadScene()
 	{
 		AURORA_INFO(Aurora::LogLayer::Serialization, "%s", filePath.value().c_str());
 
-		m_EngineContext->GetSubsystem<Aurora::Threading>()->Execute([this, filePath](Aurora::JobInformation jobInformation)
-		{
-			m_EngineContext->GetSubsystem<Aurora::World>()->DeserializeScene(filePath.value());
-		});
+		// Read on the IO threads, and deserialized by the World within its own tick, as it may be ticking on a worker right now.
+		AURORA_JOB_LABEL("Load Scene");
+		m_EngineContext->GetSubsystem<Aurora::World>()->LoadScene(filePath.value());
 	}
 }
 
@@ -109,8 +109,7 @@ bool Properties::OnKeyPressed(Aurora::KeyPressedEvent& keyPressedEvent)
         {
             if (!m_InspectedEntity.expired())
             {
-                m_InspectedEntity.lock().get()->MarkForDestruction();
-                m_EngineContext->GetSubsystem<Aurora::World>()->SetSceneDirty();
+                m_EngineContext->GetSubsystem<Aurora::World>()->EntityRemove(m_InspectedEntity.lock());
                 m_InspectedEntity.reset();
                 return true;
             }
@@ -302,11 +301,13 @@ static void DrawMaterialControl(const std::string& label, Aurora::DX11_Texture*
         {
             const std::string filePath = std::get<const char*>(dragPayload->m_Data);
 
-            engineContext->GetSubsystem<Aurora::Threading>()->Execute([TextureSetter, engineContext, filePath](Aurora::JobInformation jobInformation) mutable
+            // The setter is too large to be captured inline by a job, hence we box it.
+            auto textureSetter = std::make_shared<std::function<void(const std::shared_ptr<Aurora::DX11_Texture>&)>>(TextureSetter);
+            engineContext->GetSubsystem<Aurora::Threading>()->Execute([textureSetter, engineContext, filePath](Aurora::JobInformation jobInformation) mutable
             {
                 auto texture = engineContext->GetSubsystem<Aurora::ResourceCache>()->Load<Aurora::DX11_Texture>(filePath);
-                TextureSetter(texture);
-            });
+                (*textureSetter)(texture);
+            }, {}, Aurora::JobPriority::Background);
         }
     }
     else
@@ -315,12 +316,15 @@ static void DrawMaterialControl(const std::string& label, Aurora::DX11_Texture*
 
         if (auto dragPayload = EditorExtensions::ReceiveDragPayload(EditorExtensions::DragPayloadType::DragPayloadType_Texture))
         {
-            const std::string filePath = std::get<const char*>(dragPayload->m_Data);          
-            engineContext->GetSubsystem<Aurora::Threading>()->Execute([TextureSetter, engineContext, filePath](Aurora::JobInformation jobInformation) mutable
+            const std::string filePath = std::get<const char*>(dragPayload->m_Data);
+
+            // The setter is too large to be captured inline by a job, hence we box it.
+            auto textureSetter = std::make_shared<std::function<void(const std::shared_ptr<Aurora::DX11_Texture>&)>>(TextureSetter);
+            engineContext->GetSubsystem<Aurora::Threading>()->Execute([textureSetter, engineContext, filePath](Aurora::JobInformation jobInformation) mutable
             {
                 auto texture = engineContext->GetSubsystem<Aurora::ResourceCache>()->Load<Aurora::DX11_Texture>(filePath);
-                TextureSetter(texture);
-            });
+                (*textureSetter)(texture);
+            }, {}, Aurora::JobPriority::Background);
         }
     }
 
@@ -527,7 +531,7 @@ void Properties::ShowAudioSourceProperties(Aurora::AudioSource* audioSourceCompo
             m_EngineContext->GetSubsystem<Aurora::Threading>()->Execute([=](Aurora::JobInformation jobInformation)
             {
                 audioSourceComponent->SetAudioClip(filePath);
-            });
+            }, {}, Aurora::JobPriority::Background);
 
             // Stop playing if there's anything currently doing so.
             audioSourceComponent->Stop();
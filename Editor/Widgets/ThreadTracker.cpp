@@ -1,5 +1,8 @@
 #include "ThreadTracker.h"
 #include "../Threading/Threading.h"
+#include "../Threading/IOService.h"
+#include "../Threading/JobBenchmark.h"
+#include "../Scene/WorldBenchmark.h"
 
 ThreadTracker::ThreadTracker(Editor* editorContext, Aurora::EngineContext* engineContext) : Widget(editorContext, engineContext)
 {
@@ -14,8 +17,13 @@ void ThreadTracker::OnTickVisible()
 
     ImGui::Text("Total Thread Count: %u", m_ThreadingSubsystem->GetThreadCount());
     ImGui::Text("Thread Count Supported: %u", m_ThreadingSubsystem->GetThreadCountSupported());
+    ImGui::Text("Frame Workers: %u, Background Workers: %u", m_ThreadingSubsystem->GetFrameWorkerCount(), m_ThreadingSubsystem->GetBackgroundWorkerCount());
     ImGui::Text("Thread Count Avaliable: %u", m_ThreadingSubsystem->GetThreadCountAvaliable());
     ImGui::Text("Currently Queued Tasks: %u", m_ThreadingSubsystem->GetQueuedTasksCount());
+    if (Aurora::IOService* ioService = m_EngineContext->GetSubsystem<Aurora::IOService>())
+    {
+        ImGui::Text("IO Threads: %u, Pending Reads: %u, Read Total: %.2fMB", ioService->GetIOThreadCount(), ioService->GetPendingReadCount(), ioService->GetBytesReadTotal() / (1024.0 * 1024.0));
+    }
 
     ImGui::Spacing();
     bool mainThreadTasking = m_ThreadingSubsystem->IsMainThreadUtilitizedForTasks();
@@ -23,17 +31,161 @@ void ThreadTracker::OnTickVisible()
     {
         m_ThreadingSubsystem->UseMainThreadForTasks(mainThreadTasking);
     }
+
+    bool jobTracing = m_ThreadingSubsystem->IsJobTracingEnabled();
+    if (ImGui::Checkbox("Trace Jobs", &jobTracing))
+    {
+        m_ThreadingSubsystem->SetJobTracingEnabled(jobTracing);
+    }
+    ImGui::Text("Worker Sleeps (Last Frame): %u", m_ThreadingSubsystem->GetWorkerSleepCountLastFrame());
+    if (jobTracing)
+    {
+        ImGui::Text("Traced Events (Last Frame): %u, Dropped: %u", m_ThreadingSubsystem->GetTracedEventCountLastFrame(), m_ThreadingSubsystem->GetDroppedTraceEventCountLastFrame());
+    }
     ImGui::Spacing();
 
-    if (ImGui::Button("Singular Unit Test"))
+    if (ImGui::Button("Job Benchmark"))
+    {
+        // Blocks the editor for a few seconds. Results are logged, and written alongside our profiler sessions.
+        Aurora::JobBenchmark jobBenchmark;
+        jobBenchmark.Run();
+        jobBenchmark.WriteJson("../ProfilerLogs/JobBenchmark.json");
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("World Benchmark"))
+    {
+        // Spawns and tears down up to 100k entities within the current scene, which is otherwise left as is.
+        Aurora::WorldBenchmark worldBenchmark(m_EngineContext);
+        worldBenchmark.Run();
+        worldBenchmark.WriteJson("../ProfilerLogs/WorldBenchmark.json");
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Large Scene Benchmark"))
     {
-        m_ThreadingSubsystem->SingularTaskUnitTest();
+        // Generates scenes of up to 100k entities alongside the current one. Run the demo with -world_benchmark for a million, without the editor.
+        Aurora::WorldBenchmark worldBenchmark(m_EngineContext);
+        worldBenchmark.RunLargeScenes({ 10000, 100000 });
+        worldBenchmark.WriteJson("../ProfilerLogs/WorldBenchmark_LargeScene.json");
     }
-    
+
     ImGui::SameLine();
 
-    if (ImGui::Button("Loop Unit Test"))
+    if (ImGui::Button("Allocation Unit Test"))
     {
-        m_ThreadingSubsystem->LoopingTaskUnitTest();
+        m_ThreadingSubsystem->DispatchAllocationUnitTest();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Parallel Algorithms Unit Test"))
+    {
+        m_ThreadingSubsystem->ParallelAlgorithmsUnitTest();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Coroutine Unit Test"))
+    {
+        m_ThreadingSubsystem->CoroutineUnitTest();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Queue Contention Unit Test"))
+    {
+        m_ThreadingSubsystem->QueueContentionUnitTest();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Spinlock Contention Unit Test"))
+    {
+        m_ThreadingSubsystem->SpinlockContentionUnitTest();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("IO Service Unit Test"))
+    {
+        if (Aurora::IOService* ioService = m_EngineContext->GetSubsystem<Aurora::IOService>())
+        {
+            ioService->BatchReadUnitTest();
+        }
+    }
+
+    // Subsystem Ticks
+    ImGui::Spacing();
+    Aurora::SubsystemTickGraph& tickGraph = m_EngineContext->GetTickGraph();
+    bool parallelTick = tickGraph.IsParallelTickEnabled();
+    if (ImGui::Checkbox("Parallel Subsystem Ticks", &parallelTick))
+    {
+        tickGraph.SetParallelTickEnabled(parallelTick);
+    }
+    ImGui::Text("Subsystem Ticks: %.3fms (Serial: %.3fms, Critical Path: %.3fms)", tickGraph.GetWallMilliseconds(), tickGraph.GetSerialMilliseconds(), tickGraph.GetCriticalPathMilliseconds());
+
+    if (ImGui::TreeNode("Subsystem Tick Graph"))
+    {
+        const std::vector<Aurora::SubsystemTickGraph::Node>& nodes = tickGraph.GetNodes();
+        for (const Aurora::SubsystemTickGraph::Node& node : nodes)
+        {
+            std::string dependencies;
+            for (const uint32_t dependencyIndex : node.m_Dependencies)
+            {
+                dependencies += (dependencies.empty() ? "" : ", ") + nodes[dependencyIndex].m_Name;
+            }
+
+            ImGui::Text("%s%s: %.3fms, After: %s", node.m_Name.c_str(), node.m_Access.m_RequiresMainThread ? " (Main)" : "", node.m_TickMilliseconds, dependencies.empty() ? "-" : dependencies.c_str());
+        }
+
+        ImGui::TreePop();
+    }
+
+    // Lock Statistics
+    ImGui::Spacing();
+    bool lockStatistics = Aurora::SpinlockStatistics::IsEnabled();
+    if (ImGui::Checkbox("Record Lock Statistics", &lockStatistics))
+    {
+        Aurora::SpinlockStatistics::SetEnabled(lockStatistics);
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Reset Lock Statistics"))
+    {
+        Aurora::SpinlockStatistics::ResetAll();
+    }
+
+    if (lockStatistics && ImGui::BeginTable("Lock Statistics", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Lock");
+        ImGui::TableSetupColumn("Acquisitions");
+        ImGui::TableSetupColumn("Contended");
+        ImGui::TableSetupColumn("Spin Cycles");
+        ImGui::TableSetupColumn("Parks");
+        ImGui::TableHeadersRow();
+
+        Aurora::SpinlockStatistics::ForEach([](const Aurora::SpinlockStatistics& statistics)
+        {
+            const uint64_t acquisitions = statistics.m_Acquisitions.load(std::memory_order_relaxed);
+            const uint64_t contendedAcquisitions = statistics.m_ContendedAcquisitions.load(std::memory_order_relaxed);
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", statistics.m_Name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(acquisitions));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu (%.1f%%)", static_cast<unsigned long long>(contendedAcquisitions), acquisitions ? 100.0 * contendedAcquisitions / acquisitions : 0.0);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(statistics.m_SpinCycles.load(std::memory_order_relaxed)));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(statistics.m_ParkCount.load(std::memory_order_relaxed)));
+        });
+
+        ImGui::EndTable();
     }
 }
@@ -62,10 +62,11 @@ void Viewport::OnTickVisible()
         const std::string filePath = std::get<const char*>(payload->m_Data); // Retrieve data from main thread
 
         // Load with seperate thread.
+        AURORA_JOB_LABEL("Load Model");
         m_EngineContext->GetSubsystem<Aurora::Threading>()->Execute([this, filePath](Aurora::JobInformation jobInformation)
         {
             m_EngineContext->GetSubsystem<Aurora::ResourceCache>()->Load<Aurora::Model>(filePath);
-        });
+        }, {}, Aurora::JobPriority::Background);
     }
 
     m_EditorContext->GetWidget<EditorTools>()->OnTickViewport();